@@ -56,10 +56,11 @@ typedef void (*sighandler_t)(int);
 #include "backends/timer/default/default-timer.h"
 #include "backends/events/default/default-events.h"
 #include "backends/mixer/null/null-mixer.h"
-#include "backends/graphics/null/null-graphics.h"
 #include "gui/debugger.h"
 #endif
 
+#include "backends/graphics/null/null-graphics.h"
+
 /*
  * Include header files needed for the getFilesystemFactory() method.
  */
@@ -82,6 +83,8 @@ public:
 
 	virtual void initBackend();
 
+	virtual bool hasFeature(Feature f);
+
 	virtual bool pollEvent(Common::Event &event);
 
 	virtual Common::MutexInternal *createMutex();
@@ -119,6 +122,13 @@ OSystem_NULL::OSystem_NULL(bool silenceLogs) :
 	#else
 		#error Unknown and unsupported FS backend
 	#endif
+
+#ifdef NULL_DRIVER_USE_FOR_TEST
+	// Tests and benchmarks construct codecs which query the screen format
+	// and the CPU features, but never call initBackend()
+	_graphicsManager = new NullGraphicsManager();
+	_graphicsManager->initSize(320, 200);
+#endif
 }
 
 OSystem_NULL::~OSystem_NULL() {
@@ -159,6 +169,22 @@ void OSystem_NULL::initBackend() {
 	BaseBackend::initBackend();
 }
 
+#ifdef NULL_DRIVER_USE_FOR_TEST
+// Only set by the benchmarks, so that the unit tests exercise the portable
+// code paths unless they switch to the SIMD ones explicitly
+bool g_nullReportCpuSSE2 = false;
+#endif
+
+bool OSystem_NULL::hasFeature(Feature f) {
+#if defined(NULL_DRIVER_USE_FOR_TEST) && defined(__SSE2__)
+	// The compiler was allowed to emit SSE2, so the CPU has it
+	if (f == kFeatureCpuSSE2 && g_nullReportCpuSSE2)
+		return true;
+#endif
+
+	return ModularGraphicsBackend::hasFeature(f);
+}
+
 bool OSystem_NULL::pollEvent(Common::Event &event) {
 #ifndef NULL_DRIVER_USE_FOR_TEST
 	((DefaultTimerManager *)getTimerManager())->checkTimers();
@@ -50,6 +50,13 @@ namespace Common {
  * For example, a bit stream with the layout parameters 32, true, false
  * for valueBits, isLE and isMSB2LSB, reads 32-bit little-endian values
  * from the data stream and hands out the bits in the order of LSB to MSB.
+ *
+ * The bits are buffered in a container of up to 64 bits, which is filled
+ * with as many data values as fit whenever it runs low. The data stream
+ * is therefore read up to 8 bytes ahead of the bits consumed so far.
+ * Reading from the data stream directly while the bit stream is in use
+ * misses the buffered bytes, so callers mixing both should give the bit
+ * stream a dedicated stream, such as a MemoryReadStream over the data.
  */
 template<class STREAM, typename CONTAINER, int valueBits, bool isLE, bool MSB2LSB>
 class BitStreamImpl {
@@ -84,20 +91,31 @@ private:
 		return 0;
 	}
 
-	/** Fill the container with at least @p min bits. */
+	/**
+	 * Fill the container with at least @p min bits.
+	 *
+	 * Once the container needs data, it is topped up with as many data values
+	 * as it can hold, so that the following reads are served from the
+	 * container without going back to the stream.
+	 */
 	FORCEINLINE void fillContainer(size_t min) {
-		while (_bitsLeft < min) {
+		if (_bitsLeft >= min)
+			return;
+
+		while (_bitsLeft <= (sizeof(_bitContainer) * 8) - valueBits) {
 
 			CONTAINER data;
 			if (_pos + _bitsLeft + valueBits <= _size) {
 				data = readData();
-			} else {
+			} else if (_bitsLeft < min) {
 				// Peeking data out of bounds is well-defined and returns 0 bits.
 				// This is for convenience when using speed-up techniques reading
 				// more bits than actually available. Call eos() to check if data
 				// was actually read out of bounds. Peeking out of bounds does not
 				// set the eos flag.
 				data = 0;
+			} else {
+				break;
 			}
 
 			// Move the data value to the right position in the bit container
@@ -108,7 +126,7 @@ private:
 
 			_bitsLeft += valueBits;
 		}
-}
+	}
 
 	/** Get @p n bits from the bit container. */
 	FORCEINLINE static uint32 getNBits(CONTAINER value, size_t n) {
@@ -25,7 +25,6 @@
 #define COMMON_HUFFMAN_H
 
 #include "common/array.h"
-#include "common/list.h"
 #include "common/types.h"
 
 namespace Common {
@@ -54,6 +53,11 @@ inline uint32 REVERSEBITS(uint32 x) {
 /**
  * Huffman bit stream decoding.
  *
+ * The codes are resolved through a tree of lookup tables. The first table
+ * is indexed with the next _prefixTableBits bits of the stream and directly
+ * yields all codes of up to that length. Longer codes continue in smaller
+ * second-level (and, if needed, deeper) tables, so every code is found
+ * with one table read per level instead of being matched bit by bit.
  */
 template<class BITSTREAM>
 class Huffman {
@@ -71,30 +75,68 @@ public:
 	/** Return the next symbol in the bit stream. */
 	uint32 getSymbol(BITSTREAM &bits) const;
 
+	/** Read the next @p count symbols from the bit stream into @p dst. */
+	template<typename T>
+	void getSymbols(BITSTREAM &bits, T *dst, uint32 count) const {
+		while (count-- > 0)
+			*dst++ = (T)getSymbol(bits);
+	}
+
 private:
-	struct Symbol {
+	struct Code {
 		uint32 code;
 		uint32 symbol;
+		uint8  length;
 
-		Symbol(uint32 c, uint32 s) : code(c), symbol(s) {}
+		Code() : code(0), symbol(0), length(0) {}
+		Code(uint32 c, uint32 s, uint8 l) : code(c), symbol(s), length(l) {}
 	};
 
-	typedef List<Symbol> CodeList;
-	typedef Array<CodeList> CodeLists;
+	/**
+	 * A lookup table entry. Either a symbol together with the number of bits
+	 * its code occupies in this table, or a link to the table resolving the
+	 * following @p subBits bits. Entries without a code have a length of 0xFF.
+	 */
+	struct TableEntry {
+		uint32 value;   ///< The symbol, or the offset of the next table.
+		uint8  length;  ///< Length of the code in this table.
+		uint8  subBits; ///< Number of bits indexing the next table, 0 for symbols.
 
-	/** Lists of codes and their symbols, sorted by code length. */
-	CodeLists _codes;
+		TableEntry() : value(0), length(0xFF), subBits(0) {}
+	};
 
-	/** Prefix lookup table used to speed up the decoding of short codes. */
-	struct PrefixEntry {
-		uint32 symbol;
-		uint8  length;
+	static const uint8 _prefixTableBits = 9;
 
-		PrefixEntry() : length(0xFF) {}
-	};
+	/** All lookup tables, the first one being the prefix table. */
+	Array<TableEntry> _tables;
 
-	static const uint8 _prefixTableBits = 8;
-	PrefixEntry _prefixTable[1 << _prefixTableBits];
+	/** Return the lowest @p length bits of @p code. */
+	static uint32 lowBits(uint32 code, uint8 length) {
+		return (length >= 32) ? code : (code & ((1u << length) - 1));
+	}
+
+	/**
+	 * Return the @p n bits of @p code that follow its first @p consumed bits,
+	 * as they are peeked from the stream. MSB streams read a code starting
+	 * with its top bit, LSB streams starting with its bit 0.
+	 */
+	static uint32 nextBits(const Code &code, uint8 consumed, uint8 n) {
+		if (BITSTREAM::isMSB2LSB())
+			return lowBits(code.code >> (code.length - consumed - n), n);
+
+		return lowBits(code.code >> consumed, n);
+	}
+
+	/** Return the index of a table of @p bits bits for the @p n bits @p value, followed by the bits @p fill. */
+	static uint32 tableIndex(uint32 value, uint8 n, uint32 fill, uint8 bits) {
+		if (BITSTREAM::isMSB2LSB())
+			return (value << (bits - n)) | fill;
+
+		return value | (fill << n);
+	}
+
+	/** Fill the table at @p offset, indexed by @p bits bits following the first @p consumed bits of the codes. */
+	void buildTable(uint32 offset, uint8 bits, uint8 consumed, const Array<Code> &codes);
 };
 
 template <class BITSTREAM>
@@ -110,62 +152,88 @@ Huffman<BITSTREAM>::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *cod
 
 	assert(maxLength <= 32);
 
-	// Codes that do not fit in the prefix table are stored in the _codes array.
-	_codes.resize(MAX(maxLength - _prefixTableBits, 0));
+	Array<Code> codeList;
+	codeList.reserve(codeCount);
 
 	for (uint i = 0; i < codeCount; i++) {
-		uint8 length = lengths[i];
-
 		// The symbol. If none was specified, assume it is identical to the code index.
 		uint32 symbol = symbols ? symbols[i] : i;
 
-		if (length <= _prefixTableBits) {
-			// Short codes go in the prefix lookup table. Set all the entries in the table
-			// with an index starting with the code to the symbol value.
-			uint32 startIndex;
-			if (BITSTREAM::isMSB2LSB()) {
-				startIndex = codes[i] << (_prefixTableBits - length);
-			} else {
-				startIndex = REVERSEBITS(codes[i]) >> (32 - _prefixTableBits);
-			}
+		if (lengths[i] > 0)
+			codeList.push_back(Code(lowBits(codes[i], lengths[i]), symbol, lengths[i]));
+	}
 
-			uint32 endIndex = startIndex | ((1 << (_prefixTableBits - length)) - 1);
+	_tables.resize(1 << _prefixTableBits);
+	buildTable(0, _prefixTableBits, 0, codeList);
+}
 
-			for (uint32 j = startIndex; j <= endIndex; j++) {
-				uint32 index = BITSTREAM::isMSB2LSB() ? j : REVERSEBITS(j) >> (32 - _prefixTableBits);
-				_prefixTable[index].symbol = symbol;
-				_prefixTable[index].length = length;
+template <class BITSTREAM>
+void Huffman<BITSTREAM>::buildTable(uint32 offset, uint8 bits, uint8 consumed, const Array<Code> &codes) {
+	// Codes too long for this table, grouped by the index of their first bits
+	Array<Array<Code> > longCodes;
+
+	for (uint i = 0; i < codes.size(); i++) {
+		const Code &code = codes[i];
+
+		uint8 remaining = code.length - consumed;
+
+		if (remaining <= bits) {
+			// Set all the entries with an index starting with the code to the symbol
+			uint32 value = nextBits(code, consumed, remaining);
+
+			for (uint32 j = 0; j < (1u << (bits - remaining)); j++) {
+				TableEntry &entry = _tables[offset + tableIndex(value, remaining, j, bits)];
+
+				entry.value  = code.symbol;
+				entry.length = remaining;
 			}
 		} else {
-			// Put the code and symbol into the correct list for the length.
-			_codes[lengths[i] - 1 - _prefixTableBits].push_back(Symbol(codes[i], symbol));
+			uint32 index = nextBits(code, consumed, bits);
+
+			if (longCodes.empty())
+				longCodes.resize(1 << bits);
+
+			longCodes[index].push_back(code);
 		}
 	}
-}
 
-template <class BITSTREAM>
-uint32 Huffman<BITSTREAM>::getSymbol(BITSTREAM &bits) const {
-	uint32 code = bits.peekBits(_prefixTableBits);
+	for (uint32 index = 0; index < longCodes.size(); index++) {
+		if (longCodes[index].empty())
+			continue;
 
-	uint8 length = _prefixTable[code].length;
+		uint8 maxRemaining = 0;
+		for (uint i = 0; i < longCodes[index].size(); i++)
+			maxRemaining = MAX<uint8>(maxRemaining, longCodes[index][i].length - consumed - bits);
 
-	if (length != 0xFF) {
-		bits.skip(length);
-		return _prefixTable[code].symbol;
-	} else {
-		bits.skip(_prefixTableBits);
+		// Keep the tables for very long codes small, at the cost of another level
+		uint8 subBits = MIN(maxRemaining, _prefixTableBits);
 
-		for (uint32 i = 0; i < _codes.size(); i++) {
-			bits.addBit(code, i + _prefixTableBits);
+		uint32 subOffset = _tables.size();
+		_tables.resize(subOffset + (1 << subBits));
 
-			for (typename CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
-				if (code == cCode->code)
-					return cCode->symbol;
-		}
+		TableEntry &entry = _tables[offset + index];
+		entry.value   = subOffset;
+		entry.length  = bits;
+		entry.subBits = subBits;
+
+		buildTable(subOffset, subBits, consumed + bits, longCodes[index]);
+	}
+}
+
+template <class BITSTREAM>
+uint32 Huffman<BITSTREAM>::getSymbol(BITSTREAM &bits) const {
+	const TableEntry *entry = &_tables[bits.peekBits(_prefixTableBits)];
+
+	while (entry->subBits) {
+		bits.skip(entry->length);
+		entry = &_tables[entry->value + bits.peekBits(entry->subBits)];
 	}
 
-	error("Unknown Huffman code");
-	return 0;
+	if (entry->length == 0xFF)
+		error("Unknown Huffman code");
+
+	bits.skip(entry->length);
+	return entry->value;
 }
 
 /** @} */
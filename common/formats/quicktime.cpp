@@ -181,8 +181,47 @@ void QuickTimeParser::init() {
 				_tracks[i]->editList[0].mediaTime = 0;
 				_tracks[i]->editList[0].mediaRate = 1;
 			}
+
+			if (_tracks[i]->codecType == CODEC_TYPE_VIDEO)
+				buildSampleIndex(_tracks[i]);
+		}
+	}
+}
+
+void QuickTimeParser::buildSampleIndex(Track *track) {
+	track->sampleIndex.clear();
+
+	// The first entry has to cover the first chunk, and without sizes
+	// there is nothing to index
+	if (track->sampleToChunkCount == 0 || track->sampleToChunk[0].first != 0)
+		return;
+
+	if (track->sampleSize == 0 && !track->sampleSizes)
+		return;
+
+	track->sampleIndex.reserve(track->sampleCount);
+
+	uint32 sampleToChunkIndex = 0;
+
+	for (uint32 i = 0; i < track->chunkCount && track->sampleIndex.size() < track->sampleCount; i++) {
+		if (sampleToChunkIndex < track->sampleToChunkCount && i >= track->sampleToChunk[sampleToChunkIndex].first)
+			sampleToChunkIndex++;
+
+		const SampleToChunkEntry &chunkEntry = track->sampleToChunk[sampleToChunkIndex - 1];
+		uint32 offset = track->chunkOffsets[i];
+
+		for (uint32 j = 0; j < chunkEntry.count && track->sampleIndex.size() < track->sampleCount; j++) {
+			SampleIndexEntry sample;
+			sample.offset = offset;
+			sample.size = track->sampleSize ? track->sampleSize : track->sampleSizes[track->sampleIndex.size()];
+			sample.descId = chunkEntry.id;
+			track->sampleIndex.push_back(sample);
+
+			offset += sample.size;
 		}
 	}
+
+	debug(3, "Indexed %d of %d samples", track->sampleIndex.size(), track->sampleCount);
 }
 
 void QuickTimeParser::initParseTable() {
@@ -711,6 +750,7 @@ int QuickTimeParser::readSTSZ(Atom atom) {
 int QuickTimeParser::readSTTS(Atom atom) {
 	Track *track = _tracks.back();
 	uint32 totalSampleCount = 0;
+	uint32 totalDuration = 0;
 
 	_fd->readByte(); // version
 	_fd->readByte(); _fd->readByte(); _fd->readByte(); // flags
@@ -723,10 +763,13 @@ int QuickTimeParser::readSTTS(Atom atom) {
 	for (int32 i = 0; i < track->timeToSampleCount; i++) {
 		track->timeToSample[i].count = _fd->readUint32BE();
 		track->timeToSample[i].duration = _fd->readUint32BE();
+		track->timeToSample[i].firstSample = totalSampleCount;
+		track->timeToSample[i].startTime = totalDuration;
 
 		debug(1, "\tCount = %d, Duration = %d", track->timeToSample[i].count, track->timeToSample[i].duration);
 
 		totalSampleCount += track->timeToSample[i].count;
+		totalDuration += track->timeToSample[i].count * track->timeToSample[i].duration;
 	}
 
 	track->frameCount = totalSampleCount;
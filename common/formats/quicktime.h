@@ -112,6 +112,14 @@ protected:
 	struct TimeToSampleEntry {
 		int count;
 		int duration; // media time
+		uint32 firstSample; // first sample covered by this entry
+		uint32 startTime;   // media time of that sample
+	};
+
+	struct SampleIndexEntry {
+		uint32 offset;
+		uint32 size;
+		uint32 descId;
 	};
 
 	struct SampleToChunkEntry {
@@ -290,6 +298,10 @@ protected:
 		uint32 *keyframes;
 		int32 timeScale; // media time
 
+		// Location of every sample, resolved from the chunk tables in init()
+		// for video tracks so that random access is a single lookup
+		Array<SampleIndexEntry> sampleIndex;
+
 		uint16 width;
 		uint16 height;
 		CodecType codecType;
@@ -381,6 +393,7 @@ private:
 	bool _foundMOOV;
 
 	void initParseTable();
+	void buildSampleIndex(Track *track);
 
 	bool parsePanoramaAtoms();
 
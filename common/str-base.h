@@ -148,6 +148,13 @@ public:
 	/** Clears the string, making it empty. */
 	void clear();
 
+	/**
+	 * Make sure the string can hold at least size characters without
+	 * reallocating, so that a series of appends allocates at most once.
+	 * Never shrinks below the current contents, even if those are shared.
+	 */
+	void reserve(uint32 size) { ensureCapacity((size > _size) ? size : _size, true); }
+
 	iterator begin() {
 		// Since the user could potentially
 		// change the string via the returned
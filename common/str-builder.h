@@ -0,0 +1,82 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_STRING_BUILDER_H
+#define COMMON_STRING_BUILDER_H
+
+#include "common/str.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_str_builder String builder
+ * @ingroup common_str
+ *
+ * @brief Helper for building strings piece by piece.
+ *
+ * @{
+ */
+
+/**
+ * Accumulates a string from several pieces without creating a temporary
+ * String for each concatenation step. When the final length is known (or
+ * can be estimated), pass it to the constructor or to reserve() and the
+ * whole string is built with a single allocation.
+ *
+ * The result is handed out with finish(), which moves the accumulated
+ * storage into the returned String instead of copying it.
+ */
+class StringBuilder {
+public:
+	StringBuilder() {}
+	explicit StringBuilder(uint32 capacity) { _str.reserve(capacity); }
+
+	/** Make room for at least capacity characters in total. */
+	void reserve(uint32 capacity) { _str.reserve(capacity); }
+
+	StringBuilder &append(const String &str) { _str += str; return *this; }
+	StringBuilder &append(const char *str) { _str += str; return *this; }
+	StringBuilder &append(const char *str, uint32 len) { _str.append(str, str + len); return *this; }
+	StringBuilder &append(char c) { _str += c; return *this; }
+
+	StringBuilder &operator+=(const String &str) { return append(str); }
+	StringBuilder &operator+=(const char *str) { return append(str); }
+	StringBuilder &operator+=(char c) { return append(c); }
+
+	uint32 size() const { return _str.size(); }
+	bool empty() const { return _str.empty(); }
+	void clear() { _str.clear(); }
+
+	/** Access the string built so far. */
+	const String &str() const { return _str; }
+
+	/** Return the built string and leave the builder empty. */
+	String finish() { return static_cast<String &&>(_str); }
+
+private:
+	String _str;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -23,6 +23,7 @@
 #include "common/list.h"
 #include "common/memorypool.h"
 #include "common/str.h"
+#include "common/str-builder.h"
 #include "common/util.h"
 #include "common/mutex.h"
 
@@ -249,7 +250,9 @@ String String::substr(size_t pos, size_t len) const {
 }
 
 String String::forEachLine(String(*func)(const String, va_list args), ...) const {
-	String result = "";
+	// Most callbacks keep the line length, so start with room for the
+	// whole input instead of growing (and copying) the result per line
+	StringBuilder result(_size);
 	size_t index = findFirstOf('\n', 0);
 	size_t prev_index = 0;
 	va_list args;
@@ -257,16 +260,16 @@ String String::forEachLine(String(*func)(const String, va_list args), ...) const
 	while (index != npos) {
 		String textLine = substr(prev_index, index - prev_index);
 		textLine = (*func)(textLine, args);
-		result = result + textLine + '\n';
+		result.append(textLine).append('\n');
 		prev_index = index + 1;
 		index = findFirstOf('\n', index + 1);
 	}
 
 	String textLine = substr(prev_index);
 	textLine = (*func)(textLine, args);
-	result = result + textLine;
+	result.append(textLine);
 	va_end(args);
-	return result;
+	return result.finish();
 }
 
 #pragma mark -
@@ -340,6 +343,21 @@ String operator+(const String &x, char y) {
 	return temp;
 }
 
+String operator+(String &&x, const String &y) {
+	x += y;
+	return static_cast<String &&>(x);
+}
+
+String operator+(String &&x, const char *y) {
+	x += y;
+	return static_cast<String &&>(x);
+}
+
+String operator+(String &&x, char y) {
+	x += y;
+	return static_cast<String &&>(x);
+}
+
 #ifndef SCUMMVM_UTIL
 
 char *ltrim(char *t) {
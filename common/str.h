@@ -193,6 +193,12 @@ String operator+(const String &x, const char *y);
 String operator+(const String &x, char y);
 String operator+(char x, const String &y);
 
+// Append to a temporary string in place, so that chains like a + b + c
+// reuse the storage of the first intermediate result
+String operator+(String &&x, const String &y);
+String operator+(String &&x, const char *y);
+String operator+(String &&x, char y);
+
 // Some useful additional comparison operators for Strings
 bool operator==(const char *x, const String &y);
 bool operator!=(const char *x, const String &y);
@@ -71,6 +71,7 @@ namespace Sci {
 int g_debug_sleeptime_factor = 1;
 int g_debug_simulated_key = 0;
 bool g_debug_track_mouse_clicks = false;
+bool g_debug_track_vm_speed = false;
 
 // Refer to the "addresses" command on how to pass address parameters
 static int parse_reg_t(EngineState *s, const char *str, reg_t *dest);
@@ -87,6 +88,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerVar("gc_interval",		&engine->_gamestate->scriptGCInterval);
 	registerVar("simulated_key",		&g_debug_simulated_key);
 	registerVar("track_mouse_clicks",	&g_debug_track_mouse_clicks);
+	registerVar("track_vm_speed",	&g_debug_track_vm_speed);
 	registerCmd("speed_throttle",   WRAP_METHOD(Console, cmdSpeedThrottle));
 
 	// General
@@ -100,6 +102,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("kerncall", 		WRAP_METHOD(Console, cmdKernelCall));
 	registerCmd("kc",				WRAP_METHOD(Console, cmdKernelCall));	// alias
 	registerCmd("class_table",		WRAP_METHOD(Console, cmdClassTable));
+	registerCmd("selector_cache",	WRAP_METHOD(Console, cmdSelectorCache));
 	// Parser
 	registerCmd("suffixes",			WRAP_METHOD(Console, cmdSuffixes));
 	registerCmd("parse_grammar",		WRAP_METHOD(Console, cmdParseGrammar));
@@ -115,6 +118,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("resource_id",		WRAP_METHOD(Console, cmdResourceId));
 	registerCmd("resource_info",		WRAP_METHOD(Console, cmdResourceInfo));
 	registerCmd("resource_types",		WRAP_METHOD(Console, cmdResourceTypes));
+	registerCmd("resource_cache",		WRAP_METHOD(Console, cmdResourceCache));
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("alloc_list",				WRAP_METHOD(Console, cmdAllocList));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
@@ -148,6 +152,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
 	registerCmd("visible_plane_items", WRAP_METHOD(Console, cmdVisiblePlaneItemList));
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
+	registerCmd("frame_timings",      WRAP_METHOD(Console, cmdFrameTimings));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -163,6 +168,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -321,6 +327,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("gc_interval: Number of kernel calls in between garbage collections\n");
 	debugPrintf("simulated_key: Add a key with the specified scan code to the event list\n");
 	debugPrintf("track_mouse_clicks: Toggles mouse click tracking to the console\n");
+	debugPrintf("track_vm_speed: Toggles printing the executed script instructions per second to the console\n");
 	debugPrintf("speed_throttle: Displays or changes kGameIsRestarting maximum delay\n");
 	debugPrintf("\n");
 	debugPrintf("Debug flags\n");
@@ -338,6 +345,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" selector - Attempts to find the requested selector by name\n");
 	debugPrintf(" functions - Lists the kernel functions\n");
 	debugPrintf(" class_table - Shows the available classes\n");
+	debugPrintf(" selector_cache - Shows the hit rate of the selector lookup cache\n");
 	debugPrintf("\n");
 	debugPrintf("Parser:\n");
 	debugPrintf(" suffixes - Lists the vocabulary suffixes\n");
@@ -355,6 +363,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" resource_id - Identifies a resource number by splitting it up in resource type and resource number\n");
 	debugPrintf(" resource_info - Shows info about a resource\n");
 	debugPrintf(" resource_types - Shows the valid resource types\n");
+	debugPrintf(" resource_cache - Shows resource cache hit rates and load times, or sets the cache size\n");
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" alloc_list - Lists all allocated resources\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
@@ -382,6 +391,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" window_list / wl - Shows a list of all the windows (ports) in the draw list (SCI0 - SCI1.1)\n");
 	debugPrintf(" plane_list / pl - Shows a list of all the planes in the draw list (SCI2+)\n");
 	debugPrintf(" visible_plane_list / vpl - Shows a list of all the planes in the visible draw list (SCI2+)\n");
+	debugPrintf(" frame_timings - Shows the time spent in the stages of drawing a frame (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
@@ -398,6 +408,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows garbage collection statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -1201,6 +1212,50 @@ bool Console::cmdResourceTypes(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceCache(int argc, const char **argv) {
+	ResourceManager *resMan = _engine->getResMan();
+	ResourceCacheStatistics &stats = resMan->getCacheStatistics();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Resource cache statistics reset\n");
+		return true;
+	}
+
+	if (argc == 3 && !scumm_stricmp(argv[1], "size")) {
+		const int kiloBytes = atoi(argv[2]);
+		if (kiloBytes <= 0) {
+			debugPrintf("Invalid cache size\n");
+			return true;
+		}
+		resMan->setMaxMemoryLRU(kiloBytes * 1024);
+		debugPrintf("Resource cache size set to %d KiB\n", kiloBytes);
+		return true;
+	}
+
+	if (argc != 1) {
+		debugPrintf("Shows per-type hit rates and load/decompression times of the resource cache.\n");
+		debugPrintf("Usage: %s [reset | size <KiB>]\n", argv[0]);
+		return true;
+	}
+
+	debugPrintf("Cache size: %d KiB, cached: %d KiB (%d KiB protected), locked: %d KiB, evictions: %u\n",
+	            resMan->getMaxMemoryLRU() / 1024, resMan->getMemoryLRU() / 1024,
+	            resMan->getMemoryProtected() / 1024, resMan->getMemoryLocked() / 1024, stats.evictions);
+
+	for (int i = 0; i < kResourceTypeInvalid; i++) {
+		const uint32 requests = stats.hits[i] + stats.misses[i];
+		if (!requests)
+			continue;
+
+		debugPrintf("%-10s requests: %6u, hits: %6u (%3u%%), loads: %5u, load time: %u ms\n",
+		            getResourceTypeName((ResourceType)i), requests, stats.hits[i],
+		            (uint32)((uint64)stats.hits[i] * 100 / requests), stats.misses[i], stats.loadTime[i]);
+	}
+
+	return true;
+}
+
 bool Console::cmdHexgrep(int argc, const char **argv) {
 	if (argc < 4) {
 		debugPrintf("Searches some resources for a particular sequence of bytes, represented as decimal or hexadecimal numbers.\n");
@@ -1779,6 +1834,29 @@ bool Console::cmdClassTable(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdSelectorCache(int argc, const char **argv) {
+	SelectorLookupCache &cache = _engine->_gamestate->_segMan->getSelectorLookupCache();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		cache.resetStats();
+		debugPrintf("Selector lookup cache statistics reset\n");
+		return true;
+	}
+
+	if (argc != 1) {
+		debugPrintf("Shows how many selector lookups were served by the selector lookup cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const uint32 lookups = cache.getHits() + cache.getMisses();
+	debugPrintf("Selector lookups: %u, hits: %u, misses: %u\n", lookups, cache.getHits(), cache.getMisses());
+	if (lookups)
+		debugPrintf("Hit rate: %u%%\n", (uint32)((uint64)cache.getHits() * 100 / lookups));
+
+	return true;
+}
+
 bool Console::cmdSentenceFragments(int argc, const char **argv) {
 	debugPrintf("Sentence fragments (used to build Parse trees)\n");
 
@@ -2174,6 +2252,27 @@ bool Console::cmdPlaneList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameTimings(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+			_engine->_gfxFrameout->_frameTimings = GfxFrameout::FrameTimings();
+			debugPrintf("Frame timings reset\n");
+		} else if (argc != 1) {
+			debugPrintf("Shows the time spent in the stages of drawing a frame.\n");
+			debugPrintf("Usage: %s [reset]\n", argv[0]);
+		} else {
+			_engine->_gfxFrameout->printFrameTimings(this);
+		}
+	} else {
+		debugPrintf("This SCI version does not have frame timings\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdVisiblePlaneList(int argc, const char **argv) {
 #ifdef ENABLE_SCI32
 	if (_engine->_gfxFrameout) {
@@ -2868,7 +2967,8 @@ bool Console::cmdGCShowReachable(int argc, const char **argv) {
 	}
 
 	debugPrintf("Reachable from %04x:%04x:\n", PRINT_REG(addr));
-	const Common::Array<reg_t> tmp = mobj->listAllOutgoingReferences(addr);
+	Common::Array<reg_t> tmp;
+	mobj->listAllOutgoingReferences(addr, tmp);
 	for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it)
 		if (it->getSegment())
 			g_sci->getSciDebugger()->debugPrintf("  %04x:%04x\n", PRINT_REG(*it));
@@ -2938,6 +3038,33 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		stats.reset();
+		debugPrintf("Garbage collection statistics reset\n");
+		return true;
+	}
+
+	if (argc != 1) {
+		debugPrintf("Shows statistics about the garbage collections performed so far.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	debugPrintf("Collections: %d, every %d kernel calls\n", stats.runs, _engine->_gamestate->scriptGCInterval);
+	if (!stats.runs)
+		return true;
+
+	debugPrintf("Pause time: last %d ms, max %d ms, average %d ms\n",
+		stats.lastPauseTime, stats.maxPauseTime, stats.totalPauseTime / stats.runs);
+	debugPrintf("Last collection: %d reachable, %d freed\n", stats.lastReachable, stats.lastCollected);
+	debugPrintf("Objects freed in total: %d\n", stats.totalCollected);
+
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
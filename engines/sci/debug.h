@@ -83,6 +83,8 @@ struct DebugState {
 	StackPtr old_sp;
 	Common::List<Breakpoint> _breakpoints;   //< List of breakpoints
 	int _activeBreakpointTypes;  //< Bit mask specifying which types of breakpoints are active
+	uint32 vmSpeedSampleTime;	// Time at which the VM speed was last sampled, see track_vm_speed
+	int vmSpeedSampleSteps;		// Value of the script step counter at that time
 
 	void updateActiveBreakpointTypes();
 };
@@ -91,6 +93,7 @@ struct DebugState {
 extern int g_debug_sleeptime_factor;
 extern int g_debug_simulated_key;
 extern bool g_debug_track_mouse_clicks;
+extern bool g_debug_track_vm_speed;
 
 } // End of namespace Sci
 
@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -85,6 +86,9 @@ static AddrSet *normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_
 
 static void processWorkList(SegManager *segMan, WorklistManager &wm, const Common::Array<SegmentObj *> &heap) {
 	SegmentId stackSegment = segMan->findSegmentByType(SEG_TYPE_STACK);
+	// Outgoing references are collected into the same buffer for every
+	// object, so that its storage is only allocated once per collection
+	Common::Array<reg_t> refs;
 	while (!wm._worklist.empty()) {
 		reg_t reg = wm._worklist.back();
 		wm._worklist.pop_back();
@@ -92,7 +96,9 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 			debugC(kDebugLevelGC, "[GC] Checking %04x:%04x", PRINT_REG(reg));
 			if (reg.getSegment() < heap.size() && heap[reg.getSegment()]) {
 				// Valid heap object? Find its outgoing references!
-				wm.pushArray(heap[reg.getSegment()]->listAllOutgoingReferences(reg));
+				refs.resize(0);
+				heap[reg.getSegment()]->listAllOutgoingReferences(reg, refs);
+				wm.pushArray(refs);
 			}
 		}
 	}
@@ -180,6 +186,9 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	GCStatistics &stats = s->gcStats;
+	const uint32 startTime = g_system->getMillis();
+	uint collected = 0;
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -214,6 +223,7 @@ void run_gc(EngineState *s) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
+					collected++;
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
 #endif
@@ -223,8 +233,20 @@ void run_gc(EngineState *s) {
 		}
 	}
 
+	stats.lastReachable = activeRefs->size();
 	delete activeRefs;
 
+	const uint32 pauseTime = g_system->getMillis() - startTime;
+	stats.runs++;
+	stats.lastPauseTime = pauseTime;
+	stats.totalPauseTime += pauseTime;
+	if (pauseTime > stats.maxPauseTime)
+		stats.maxPauseTime = pauseTime;
+	stats.lastCollected = collected;
+	stats.totalCollected += collected;
+
+	debugC(kDebugLevelGC, "[GC] Freed %d objects, %d reachable, took %d ms", collected, stats.lastReachable, pauseTime);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
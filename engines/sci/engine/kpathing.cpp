@@ -226,8 +226,24 @@ struct Polygon {
 	// Circular list of vertices
 	CircularVertexList vertices;
 
+	// Bounding box of the vertices
+	int16 minX, minY, maxX, maxY;
+
 public:
-	Polygon(int t) : type(t) {
+	Polygon(int t) : type(t), minX(0), minY(0), maxX(0), maxY(0) {
+	}
+
+	void updateBounds() {
+		Vertex *vertex;
+
+		minX = minY = 0x7fff;
+		maxX = maxY = -0x8000;
+		CLIST_FOREACH(vertex, &vertices) {
+			minX = MIN(minX, vertex->v.x);
+			minY = MIN(minY, vertex->v.y);
+			maxX = MAX(maxX, vertex->v.x);
+			maxY = MAX(maxY, vertex->v.y);
+		}
 	}
 
 	~Polygon() {
@@ -714,26 +730,45 @@ static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
 			continue;
 
+		// An edge can only intersect the line of sight, or have a vertex
+		// on it, if its polygon's bounding box overlaps that of the line
+		const int16 minX = MIN(vertex_cur->v.x, vertex->v.x);
+		const int16 minY = MIN(vertex_cur->v.y, vertex->v.y);
+		const int16 maxX = MAX(vertex_cur->v.x, vertex->v.x);
+		const int16 maxY = MAX(vertex_cur->v.y, vertex->v.y);
+
 		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
+		bool blocked = false;
+		for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end() && !blocked; ++it) {
+			Polygon *polygon = *it;
+
+			if (polygon->maxX < minX || polygon->minX > maxX || polygon->maxY < minY || polygon->minY > maxY)
+				continue;
+
+			Vertex *edge;
+			CLIST_FOREACH(edge, &polygon->vertices) {
+				if (!VERTEX_HAS_EDGES(edge))
+					break;
+
 				if (between(vertex_cur->v, vertex->v, edge->v)) {
 					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge))) {
+						blocked = true;
 						break;
+					}
 
 					// This edge won't properly intersect, so we continue
 					continue;
 				}
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v)) {
+					blocked = true;
 					break;
+				}
 			}
 		}
 
-		if (j == s->vertices)
+		if (!blocked)
 			visVerts->push_front(vertex);
 	}
 
@@ -1345,6 +1380,8 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		CLIST_FOREACH(vertex, &polygon->vertices) {
 			pf_s->vertex_index[count++] = vertex;
 		}
+
+		polygon->updateBounds();
 	}
 
 	pf_s->vertices = count;
@@ -1546,6 +1583,107 @@ static reg_t output_path(PathfindingState *p, EngineState *s) {
 	return output;
 }
 
+/**
+ * Builds the key identifying an AvoidPath query: its parameters, the current
+ * room (which some workarounds depend on) and the contents of all polygons.
+ * Returns false if the polygons can't be read, in which case the query is not
+ * cached.
+ */
+static bool buildAvoidPathKey(EngineState *s, reg_t poly_list, const Common::Point &start, const Common::Point &end, int width, int height, int opt, Common::Array<int16> &key) {
+	SegManager *segMan = s->_segMan;
+
+	key.push_back(s->currentRoomNumber());
+	key.push_back(start.x);
+	key.push_back(start.y);
+	key.push_back(end.x);
+	key.push_back(end.y);
+	key.push_back(width);
+	key.push_back(height);
+	key.push_back(opt);
+
+	if (!poly_list.getSegment())
+		return true;
+
+	List *list = segMan->lookupList(poly_list);
+	Node *node = segMan->lookupNode(list->first);
+
+	while (node) {
+		if (!node->value.isNull()) {
+			reg_t points = readSelector(segMan, node->value, SELECTOR(points));
+			int size = readSelectorValue(segMan, node->value, SELECTOR(size));
+
+#ifdef ENABLE_SCI32
+			if (segMan->isHeapObject(points))
+				points = readSelector(segMan, points, SELECTOR(data));
+#endif
+
+			key.push_back(readSelectorValue(segMan, node->value, SELECTOR(type)));
+			key.push_back(size);
+
+			if (size) {
+				SegmentRef pointList = segMan->dereference(points);
+				if (!pointList.isValid() || pointList.skipByte || pointList.maxSize < size * POLY_POINT_SIZE)
+					return false;
+
+				for (int i = 0; i < size; i++) {
+					Common::Point point = readPoint(pointList, i);
+					key.push_back(point.x);
+					key.push_back(point.y);
+				}
+			}
+		}
+
+		node = segMan->lookupNode(node->succ);
+	}
+
+	return true;
+}
+
+/**
+ * Remembers the path returned for an AvoidPath query
+ */
+static void cacheAvoidPath(EngineState *s, const Common::Array<int16> &key, reg_t output) {
+	SegmentRef arrayRef = s->_segMan->dereference(output);
+	assert(arrayRef.isValid() && !arrayRef.skipByte);
+
+	AvoidPathCacheEntry *entry;
+	if (s->_avoidPathCache.size() < EngineState::kAvoidPathCacheSize) {
+		s->_avoidPathCache.push_back(AvoidPathCacheEntry());
+		entry = &s->_avoidPathCache.back();
+	} else {
+		entry = &s->_avoidPathCache[s->_avoidPathCacheNext];
+		s->_avoidPathCacheNext = (s->_avoidPathCacheNext + 1) % EngineState::kAvoidPathCacheSize;
+	}
+
+	entry->key = key;
+	entry->path.clear();
+
+	const int maxPoints = arrayRef.maxSize / POLY_POINT_SIZE;
+	for (int i = 0; i < maxPoints; i++) {
+		Common::Point point = readPoint(arrayRef, i);
+		if (point.x == POLY_LAST_POINT && point.y == POLY_LAST_POINT)
+			break;
+		entry->path.push_back(point.x);
+		entry->path.push_back(point.y);
+	}
+}
+
+/**
+ * Returns a copy of a cached AvoidPath result in newly allocated memory
+ */
+static reg_t output_cached_path(EngineState *s, const AvoidPathCacheEntry &entry) {
+	const int numPoints = entry.path.size() / 2;
+	reg_t output = allocateOutputArray(s->_segMan, numPoints + 1);
+	SegmentRef arrayRef = s->_segMan->dereference(output);
+	assert(arrayRef.isValid() && !arrayRef.skipByte);
+
+	for (int i = 0; i < numPoints; i++)
+		writePoint(arrayRef, i, Common::Point(entry.path[i * 2], entry.path[i * 2 + 1]));
+	writePoint(arrayRef, numPoints, Common::Point(POLY_LAST_POINT, POLY_LAST_POINT));
+
+	return output;
+}
+
 reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 	Common::Point start = Common::Point(argv[0].toSint16(), argv[1].toSint16());
 
@@ -1611,6 +1749,20 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			}
 		}
 
+		// Some games call AvoidPath for every actor on every cycle with the
+		// same input, so recent results are reused. The debug output is
+		// only produced by an actual search.
+		Common::Array<int16> cacheKey;
+		const bool useCache = !DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath) &&
+			buildAvoidPathKey(s, poly_list, start, end, width, height, opt, cacheKey);
+
+		if (useCache) {
+			for (uint i = 0; i < s->_avoidPathCache.size(); i++) {
+				if (s->_avoidPathCache[i].key == cacheKey)
+					return output_cached_path(s, s->_avoidPathCache[i]);
+			}
+		}
+
 		PathfindingState *p = convert_polygon_set(s, poly_list, start, end, width, height, opt);
 
 		if (!p) {
@@ -1634,6 +1786,9 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 		output = output_path(p, s);
 		delete p;
 
+		if (useCache)
+			cacheAvoidPath(s, cacheKey, output);
+
 		// Memory is freed by explicit calls to Memory
 		return output;
 	}
@@ -188,6 +188,12 @@ public:
 
 	// No setter for the name selector
 
+	/**
+	 * Returns the definition of the object within its owner script, which is
+	 * shared by the object and all of its clones.
+	 */
+	const byte *getBaseObjectData() const { return _baseObj.data(); }
+
 	reg_t getPropDictSelector() const {
 #ifdef ENABLE_SCI32
 		if (getSciVersion() == SCI_VERSION_3)
@@ -1204,17 +1204,16 @@ Common::Array<reg_t> Script::listAllDeallocatable(SegmentId segId) const {
 	return Common::Array<reg_t>(&r, 1);
 }
 
-Common::Array<reg_t> Script::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> tmp;
+void Script::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
 	if (addr.getOffset() <= _buf->size() && addr.getOffset() >= (uint)-SCRIPT_OBJECT_MAGIC_OFFSET && offsetIsObject(addr.getOffset())) {
 		const Object *obj = getObject(addr.getOffset());
 		if (obj) {
 			// Note all local variables, if we have a local variable environment
 			if (_localsSegment)
-				tmp.push_back(make_reg(_localsSegment, 0));
+				refs.push_back(make_reg(_localsSegment, 0));
 
 			for (uint i = 0; i < obj->getVarCount(); i++)
-				tmp.push_back(obj->getVariable(i));
+				refs.push_back(obj->getVariable(i));
 		} else {
 			error("Request for outgoing script-object reference at %04x:%04x failed in script %d", PRINT_REG(addr), _nr);
 		}
@@ -1222,7 +1221,6 @@ Common::Array<reg_t> Script::listAllOutgoingReferences(reg_t addr) const {
 		/*		warning("Unexpected request for outgoing script-object references at %04x:%04x", PRINT_REG(addr));*/
 		/* Happens e.g. when we're looking into strings */
 	}
-	return tmp;
 }
 
 Common::Array<reg_t> Script::listObjectReferences() const {
@@ -143,7 +143,7 @@ public:
 	reg_t findCanonicAddress(SegManager *segMan, reg_t sub_addr) const override;
 	void freeAtAddress(SegManager *segMan, reg_t sub_addr) override;
 	Common::Array<reg_t> listAllDeallocatable(SegmentId segId) const override;
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	/**
 	 * Return a list of all references to objects in this script
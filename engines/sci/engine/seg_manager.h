@@ -460,6 +460,18 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Returns a counter which is incremented whenever a script is loaded or
+	 * unloaded. Caches that are keyed by script addresses use it to find out
+	 * when their contents have become stale.
+	 */
+	uint32 getScriptGeneration() const { return _scriptGeneration; }
+
+	/**
+	 * Returns the cache used by lookupSelector().
+	 */
+	SelectorLookupCache &getSelectorLookupCache() { return _selectorLookupCache; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -474,6 +486,9 @@ private:
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
 	SegmentId _hunksSegId; ///< ID of the (a) hunk segment
 
+	uint32 _scriptGeneration; ///< Incremented whenever a script is loaded or unloaded
+	SelectorLookupCache _selectorLookupCache;
+
 	// Statically allocated memory for system strings
 	reg_t _saveDirPtr;
 	reg_t _parserPtr;
@@ -88,8 +88,7 @@ SegmentRef SegmentObj::dereference(reg_t pointer) {
 
 //-------------------- clones --------------------
 
-Common::Array<reg_t> CloneTable::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> tmp;
+void CloneTable::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
 //	assert(addr.segment == _segId);
 
 	if (!isValidEntry(addr.getOffset())) {
@@ -100,13 +99,11 @@ Common::Array<reg_t> CloneTable::listAllOutgoingReferences(reg_t addr) const {
 
 	// Emit all member variables (including references to the 'super' delegate)
 	for (uint i = 0; i < clone->getVarCount(); i++)
-		tmp.push_back(clone->getVariable(i));
+		refs.push_back(clone->getVariable(i));
 
 	// Note that this also includes the 'base' object, which is part of the script and therefore also emits the locals.
-	tmp.push_back(clone->getPos());
+	refs.push_back(clone->getPos());
 	//debugC(kDebugLevelGC, "[GC] Reporting clone-pos %04x:%04x", PRINT_REG(clone->pos));
-
-	return tmp;
 }
 
 void CloneTable::freeAtAddress(SegManager *segMan, reg_t addr) {
@@ -166,12 +163,8 @@ reg_t LocalVariables::findCanonicAddress(SegManager *segMan, reg_t addr) const {
 	return make_reg(owner_seg, 0);
 }
 
-Common::Array<reg_t> LocalVariables::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> tmp;
-	for (uint i = 0; i < _locals.size(); i++)
-		tmp.push_back(_locals[i]);
-
-	return tmp;
+void LocalVariables::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
+	refs.push_back(_locals);
 }
 
 
@@ -191,36 +184,30 @@ SegmentRef DataStack::dereference(reg_t pointer) {
 	return ret;
 }
 
-Common::Array<reg_t> DataStack::listAllOutgoingReferences(reg_t object) const {
-	Common::Array<reg_t> tmp;
+void DataStack::listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const {
+	refs.reserve(refs.size() + _capacity);
 	for (uint i = 0; i < _capacity; i++)
-		tmp.push_back(_entries[i]);
-
-	return tmp;
+		refs.push_back(_entries[i]);
 }
 
 //-------------------- lists --------------------
 
-Common::Array<reg_t> ListTable::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> tmp;
+void ListTable::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
 	if (!isValidEntry(addr.getOffset())) {
 		error("Invalid list referenced for outgoing references: %04x:%04x", PRINT_REG(addr));
 	}
 
 	const List *list = &at(addr.getOffset());
 
-	tmp.push_back(list->first);
-	tmp.push_back(list->last);
+	refs.push_back(list->first);
+	refs.push_back(list->last);
 	// We could probably get away with just one of them, but
 	// let's be conservative here.
-
-	return tmp;
 }
 
 //-------------------- nodes --------------------
 
-Common::Array<reg_t> NodeTable::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> tmp;
+void NodeTable::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
 	if (!isValidEntry(addr.getOffset())) {
 		error("Invalid node referenced for outgoing references: %04x:%04x", PRINT_REG(addr));
 	}
@@ -228,12 +215,10 @@ Common::Array<reg_t> NodeTable::listAllOutgoingReferences(reg_t addr) const {
 
 	// We need all four here. Can't just stick with 'pred' OR 'succ' because node operations allow us
 	// to walk around from any given node
-	tmp.push_back(node->pred);
-	tmp.push_back(node->succ);
-	tmp.push_back(node->key);
-	tmp.push_back(node->value);
-
-	return tmp;
+	refs.push_back(node->pred);
+	refs.push_back(node->succ);
+	refs.push_back(node->key);
+	refs.push_back(node->value);
 }
 
 //-------------------- dynamic memory --------------------
@@ -264,12 +249,11 @@ SegmentRef ArrayTable::dereference(reg_t pointer) {
 	return ret;
 }
 
-Common::Array<reg_t> ArrayTable::listAllOutgoingReferences(reg_t addr) const {
-	Common::Array<reg_t> refs;
+void ArrayTable::listAllOutgoingReferences(reg_t addr, Common::Array<reg_t> &refs) const {
 	if (!isValidEntry(addr.getOffset())) {
 		// Scripts may still hold references to array memory that has been
 		// explicitly freed; ignore these references
-		return refs;
+		return;
 	}
 
 	SciArray &array = const_cast<SciArray &>(at(addr.getOffset()));
@@ -281,8 +265,6 @@ Common::Array<reg_t> ArrayTable::listAllOutgoingReferences(reg_t addr) const {
 			}
 		}
 	}
-
-	return refs;
 }
 
 #endif
@@ -135,12 +135,11 @@ public:
 	 * Iterates over all references reachable from the specified object.
 	 * Used by the garbage collector.
 	 * @param  object	object (within the current segment) to analyze
-	 * @return a list of outgoing references within the object
+	 * @param  refs	array the outgoing references within the object are appended to
 	 *
 	 * @note This function may also choose to report numbers (segment 0) as adresses
 	 */
-	virtual Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const {
-		return Common::Array<reg_t>();
+	virtual void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const {
 	}
 };
 
@@ -156,7 +155,7 @@ public:
 	}
 	SegmentRef dereference(reg_t pointer) override;
 	reg_t findCanonicAddress(SegManager *segMan, reg_t sub_addr) const override;
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 };
@@ -180,7 +179,7 @@ public:
 	reg_t findCanonicAddress(SegManager *segMan, reg_t addr) const override {
 		return make_reg(addr.getSegment(), 0);
 	}
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 };
@@ -320,7 +319,7 @@ struct CloneTable : public SegmentObjTable<Clone> {
 	CloneTable() : SegmentObjTable<Clone>(SEG_TYPE_CLONES) {}
 
 	void freeAtAddress(SegManager *segMan, reg_t sub_addr) override;
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 };
@@ -333,7 +332,7 @@ struct NodeTable : public SegmentObjTable<Node> {
 	void freeAtAddress(SegManager *segMan, reg_t sub_addr) override {
 		freeEntry(sub_addr.getOffset());
 	}
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 };
@@ -346,7 +345,7 @@ struct ListTable : public SegmentObjTable<List> {
 	void freeAtAddress(SegManager *segMan, reg_t sub_addr) override {
 		freeEntry(sub_addr.getOffset());
 	}
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 };
@@ -905,7 +904,7 @@ protected:
 struct ArrayTable : public SegmentObjTable<SciArray> {
 	ArrayTable() : SegmentObjTable<SciArray>(SEG_TYPE_ARRAY) {}
 
-	Common::Array<reg_t> listAllOutgoingReferences(reg_t object) const override;
+	void listAllOutgoingReferences(reg_t object, Common::Array<reg_t> &refs) const override;
 
 	void saveLoadWithSerializer(Common::Serializer &ser) override;
 	SegmentRef dereference(reg_t pointer) override;
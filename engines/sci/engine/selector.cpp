@@ -323,37 +323,56 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
-SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
-	const Object *obj = segMan->getObject(obj_location);
-	int index;
-	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
+SelectorLookupCache::SelectorLookupCache() : _scriptGeneration(0), _hits(0), _misses(0) {
+	flush();
+}
 
-	// Early SCI versions used the LSB in the selector ID as a read/write
-	// toggle, meaning that we must remove it for selector lookup.
-	if (oldScriptHeader)
-		selectorId &= ~1;
+void SelectorLookupCache::flush() {
+	for (uint i = 0; i < kCacheSize; i++)
+		_entries[i].baseObj = nullptr;
+}
 
-	if (!obj) {
-		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
+SelectorLookupCache::Entry &SelectorLookupCache::find(const SegManager *segMan, const Object *obj, Selector selector, bool &hit) {
+	if (_scriptGeneration != segMan->getScriptGeneration()) {
+		flush();
+		_scriptGeneration = segMan->getScriptGeneration();
 	}
 
-	index = obj->locateVarSelector(segMan, selectorId);
+	const void *baseObj = obj->getBaseObjectData();
+	const reg_t species = obj->getSpeciesSelector();
+	const reg_t superClass = obj->getSuperClassSelector();
 
-	if (index >= 0) {
+	const uint32 hash = (uint32)((uintptr)baseObj >> 3) ^ ((uint32)selector * 31);
+	Entry &entry = _entries[hash & (kCacheSize - 1)];
+
+	hit = baseObj && entry.baseObj == baseObj && entry.selector == selector &&
+		entry.species == species && entry.superClass == superClass;
+
+	if (hit) {
+		_hits++;
+	} else {
+		_misses++;
+		entry.baseObj = baseObj;
+		entry.species = species;
+		entry.superClass = superClass;
+		entry.selector = selector;
+	}
+
+	return entry;
+}
+
+static SelectorType lookupSelectorUncached(SegManager *segMan, const Object *obj, Selector selectorId, int &varIndex, reg_t &func) {
+	varIndex = obj->locateVarSelector(segMan, selectorId);
+
+	if (varIndex >= 0) {
 		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
 		return kSelectorVariable;
 	} else {
 		// Check if it's a method, with recursive lookup in superclasses
 		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
+			const int index = obj->funcSelectorPosition(selectorId);
 			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
+				func = obj->getFunction(index);
 				return kSelectorMethod;
 			} else {
 				obj = segMan->getObject(obj->getSuperClassSelector());
@@ -362,9 +381,39 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 
 		return kSelectorNone;
 	}
+}
+
+SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
+	const Object *obj = segMan->getObject(obj_location);
+	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
+
+	// Early SCI versions used the LSB in the selector ID as a read/write
+	// toggle, meaning that we must remove it for selector lookup.
+	if (oldScriptHeader)
+		selectorId &= ~1;
 
+	if (!obj) {
+		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
+	}
+
+	bool hit;
+	SelectorLookupCache::Entry &entry = segMan->getSelectorLookupCache().find(segMan, obj, selectorId, hit);
+	if (!hit) {
+		entry.func = NULL_REG;
+		entry.type = lookupSelectorUncached(segMan, obj, selectorId, entry.varIndex, entry.func);
+	}
+
+	if (entry.type == kSelectorVariable) {
+		if (varp) {
+			varp->obj = obj_location;
+			varp->varindex = entry.varIndex;
+		}
+	} else if (entry.type == kSelectorMethod) {
+		if (fptr)
+			*fptr = entry.func;
+	}
 
-//	return _lookupSelector_function(segMan, obj, selectorId, fptr);
+	return entry.type;
 }
 
 } // End of namespace Sci
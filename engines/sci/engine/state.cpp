@@ -89,6 +89,9 @@ void EngineState::reset(bool isRestoring) {
 
 	_delayedRestoreGameId = -1;
 
+	_avoidPathCache.clear();
+	_avoidPathCacheNext = 0;
+
 	_kq7MacSaveGameId = -1;
 	_kq7MacSaveGameDescription.clear();
 
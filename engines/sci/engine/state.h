@@ -97,6 +97,42 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * A recent kAvoidPath query together with its result. The key holds the
+ * complete input, including the contents of all polygons, so entries are
+ * never stale and don't need to be invalidated.
+ */
+struct AvoidPathCacheEntry {
+	Common::Array<int16> key;
+	Common::Array<int16> path; ///< x/y pairs of the resulting path, without the sentinel
+};
+
+/**
+ * Statistics about garbage collection runs, shown by the gc_stats console
+ * command. Times are in milliseconds.
+ */
+struct GCStatistics {
+	uint32 runs; //< Number of garbage collections performed
+	uint32 lastPauseTime; //< Duration of the most recent collection
+	uint32 maxPauseTime; //< Duration of the longest collection
+	uint32 totalPauseTime; //< Accumulated duration of all collections
+	uint32 lastReachable; //< Number of reachable objects found by the most recent collection
+	uint32 lastCollected; //< Number of objects freed by the most recent collection
+	uint32 totalCollected; //< Number of objects freed by all collections
+
+	GCStatistics() { reset(); }
+
+	void reset() {
+		runs = 0;
+		lastPauseTime = 0;
+		maxPauseTime = 0;
+		totalPauseTime = 0;
+		lastReachable = 0;
+		lastCollected = 0;
+		totalCollected = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 	EngineState(SegManager *segMan);
 	~EngineState() override;
@@ -173,6 +209,8 @@ struct EngineState : public Common::Serializable {
 	int scriptStepCounter; // Counts the number of steps executed
 	int scriptGCInterval; // Number of steps in between gcs
 
+	InstructionCache _instructionCache; // Decoded instructions of the scripts currently running
+
 	uint16 currentRoomNumber() const;
 	void setRoomNumber(uint16 roomNumber);
 
@@ -188,6 +226,13 @@ struct EngineState : public Common::Serializable {
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics gcStats; /**< Statistics about garbage collection runs */
+
+	enum {
+		kAvoidPathCacheSize = 8
+	};
+	Common::Array<AvoidPathCacheEntry> _avoidPathCache; /**< Results of recent kAvoidPath queries */
+	uint _avoidPathCacheNext; /**< Entry of _avoidPathCache to replace next */
 
 	MessageState *_msgState;
 	void initMessageState();
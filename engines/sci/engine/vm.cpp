@@ -22,6 +22,7 @@
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/system.h"
 
 #include "sci/sci.h"
 #include "sci/console.h"
@@ -510,6 +511,51 @@ int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4])
 	return offset;
 }
 
+InstructionCache::InstructionCache() : _scriptGeneration(0) {
+	flush();
+}
+
+void InstructionCache::flush() {
+	for (uint i = 0; i < kCacheSize; i++)
+		_entries[i].segment = 0;
+}
+
+int InstructionCache::read(const SegManager *segMan, const Script *scr, reg_t pc, byte &extOpcode, int16 opparams[4]) {
+	if (_scriptGeneration != segMan->getScriptGeneration()) {
+		flush();
+		_scriptGeneration = segMan->getScriptGeneration();
+	}
+
+	const uint32 offset = pc.getOffset();
+	Entry &entry = _entries[(offset ^ (pc.getSegment() << 5)) & (kCacheSize - 1)];
+
+	if (entry.segment != pc.getSegment() || entry.offset != offset) {
+		entry.size = readPMachineInstruction(scr->getBuf(offset), entry.extOpcode, entry.opparams);
+		entry.segment = pc.getSegment();
+		entry.offset = offset;
+	}
+
+	extOpcode = entry.extOpcode;
+	memcpy(opparams, entry.opparams, sizeof(entry.opparams));
+	return entry.size;
+}
+
+static void trackVMSpeed(EngineState *s) {
+	DebugState &debugState = g_sci->_debugState;
+	const uint32 curTime = g_system->getMillis();
+	const uint32 elapsed = curTime - debugState.vmSpeedSampleTime;
+
+	if (elapsed < 1000)
+		return;
+
+	const uint32 steps = (uint32)(s->scriptStepCounter - debugState.vmSpeedSampleSteps);
+	if (debugState.vmSpeedSampleTime)
+		g_sci->getSciDebugger()->debugPrintf("VM: %u instructions per second\n", (uint)((uint64)steps * 1000 / elapsed));
+
+	debugState.vmSpeedSampleTime = curTime;
+	debugState.vmSpeedSampleSteps = s->scriptStepCounter;
+}
+
 uint32 findOffset(const int16 relOffset, const Script *scr, const uint32 pcOffset) {
 	uint32 offset;
 
@@ -622,7 +668,7 @@ void run_vm(EngineState *s) {
 
 		// Get opcode
 		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		s->xs->addr.pc.incOffset(s->_instructionCache.read(s->_segMan, scr, s->xs->addr.pc, extOpcode, opparams));
 		const byte opcode = extOpcode >> 1;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
@@ -853,6 +899,9 @@ void run_vm(EngineState *s) {
 				run_gc(s);
 			}
 
+			if (g_debug_track_vm_speed)
+				trackVMSpeed(s);
+
 			// Call kernel function
 			s->xs->sp -= (opparams[1] >> 1) + 1;
 
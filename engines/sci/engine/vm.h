@@ -397,6 +397,61 @@ void run_vm(EngineState *s);
 SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
 		ObjVarRef *varp, reg_t *fptr);
 
+/**
+ * Direct-mapped cache of lookupSelector() results. Sends walk the superclass
+ * chain of the receiving object, which scripts do thousands of times per
+ * game cycle for the same handful of classes and selectors.
+ *
+ * Entries are keyed by the object's definition (which is shared by its
+ * clones), its species and superclass, so that all instances of a class
+ * share their entries. The cache is flushed whenever a script is loaded or
+ * unloaded.
+ */
+class SelectorLookupCache {
+public:
+	struct Entry {
+		const void *baseObj; ///< Definition of the object, nullptr marks an empty entry
+		reg_t species;
+		reg_t superClass;
+		Selector selector;
+		SelectorType type;
+		int varIndex; ///< Index of the property, for kSelectorVariable
+		reg_t func; ///< Address of the method, for kSelectorMethod
+	};
+
+	SelectorLookupCache();
+
+	/**
+	 * Finds the entry for the given object and selector.
+	 * @param[in] segMan	the segment manager, used to detect script changes
+	 * @param[in] obj		the object to look the selector up in
+	 * @param[in] selector	the selector to look up
+	 * @param[out] hit		whether the entry already contains the result
+	 * @return the cache entry. On a miss, it has been prepared for the given
+	 *         key, and the caller must fill in the result.
+	 */
+	Entry &find(const SegManager *segMan, const Object *obj, Selector selector, bool &hit);
+
+	/**
+	 * Invalidates all cached lookups.
+	 */
+	void flush();
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	void resetStats() { _hits = _misses = 0; }
+
+private:
+	enum {
+		kCacheSize = 512 // Must be a power of 2
+	};
+
+	Entry _entries[kCacheSize];
+	uint32 _scriptGeneration; ///< SegManager script generation the entries belong to
+	uint32 _hits;
+	uint32 _misses;
+};
+
 /**
  * Read a PMachine instruction from a memory buffer and return its length.
  *
@@ -415,6 +470,54 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
  */
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]);
 
+/**
+ * Direct-mapped cache of decoded PMachine instructions, indexed by their
+ * address. Scripts spend most of their time in a few small loops (the Doit
+ * methods of the cast, list iteration), so caching the decoded operands
+ * saves run_vm() from parsing the same instructions over and over again.
+ *
+ * The cache is flushed whenever a script is loaded or unloaded, as segment
+ * ids get reused and the cached addresses would become stale.
+ */
+class InstructionCache {
+public:
+	InstructionCache();
+
+	/**
+	 * Reads the PMachine instruction at the given address, either from the
+	 * cache or by decoding it with readPMachineInstruction().
+	 *
+	 * @param[in] segMan	the segment manager, used to detect script changes
+	 * @param[in] scr		the script the instruction belongs to
+	 * @param[in] pc		the address of the instruction
+	 * @param[out] extOpcode	"extended" opcode of the parsed instruction
+	 * @param[out] opparams	parameter for the parsed instruction
+	 * @return the length in bytes of the instruction
+	 */
+	int read(const SegManager *segMan, const Script *scr, reg_t pc, byte &extOpcode, int16 opparams[4]);
+
+	/**
+	 * Invalidates all cached instructions.
+	 */
+	void flush();
+
+private:
+	enum {
+		kCacheSize = 1024 // Must be a power of 2
+	};
+
+	struct Entry {
+		SegmentId segment; // 0 marks an empty entry
+		uint32 offset;
+		int16 opparams[4];
+		uint16 size;
+		byte extOpcode;
+	};
+
+	Entry _entries[kCacheSize];
+	uint32 _scriptGeneration; ///< SegManager script generation the entries belong to
+};
+
 /**
  * Finds the script-absolute offset of a relative object offset.
  *
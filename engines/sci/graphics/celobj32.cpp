@@ -91,6 +91,8 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler = new CelScaler();
 	_cache = new CelCache(100);
+	_scaledCache = new ScaledCelCache();
+	_scaledCacheSize = 0;
 }
 
 void CelObj::deinit() {
@@ -98,6 +100,8 @@ void CelObj::deinit() {
 	_scaler = nullptr;
 	delete _cache;
 	_cache = nullptr;
+	delete _scaledCache;
+	_scaledCache = nullptr;
 }
 
 #pragma mark -
@@ -170,6 +174,7 @@ struct SCALER_Scale {
 	int16 _x;
 	static int16 _valuesX[kCelScalerTableSize];
 	static int16 _valuesY[kCelScalerTableSize];
+	static int16 _copyColumns[kCelScalerTableSize];
 
 	SCALER_Scale(const CelObj &celObj, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio scaleX, const Ratio scaleY) :
 	_row(nullptr),
@@ -240,14 +245,26 @@ struct SCALER_Scale {
 				scaledPosition.y,
 				scaledPosition.x + (celObj._width * scaleX).toInt(),
 				scaledPosition.y + (celObj._height * scaleY).toInt());
-			_sourceBuffer = Common::SharedPtr<Buffer>(new Buffer(), Graphics::SurfaceDeleter());
-			_sourceBuffer->create(
-				scaledImageRect.width(), scaledImageRect.height(),
-				Graphics::PixelFormat::createFormatCLUT8());
-			Copier copier(_reader, *_sourceBuffer);
-			Graphics::larryScale(
-				celObj._width, celObj._height, celObj._skipColor, copier,
-				scaledImageRect.width(), scaledImageRect.height(), copier);
+			ScaledCelKey key;
+			key.info = celObj._info;
+			key.larryScale = true;
+			key.scaleX = scaleX;
+			key.scaleY = scaleY;
+			bool seen;
+			_sourceBuffer = celObj.searchScaledCache(key, seen);
+			if (!_sourceBuffer) {
+				_sourceBuffer = Common::SharedPtr<Buffer>(new Buffer(), Graphics::SurfaceDeleter());
+				_sourceBuffer->create(
+					scaledImageRect.width(), scaledImageRect.height(),
+					Graphics::PixelFormat::createFormatCLUT8());
+				Copier copier(_reader, *_sourceBuffer);
+				Graphics::larryScale(
+					celObj._width, celObj._height, celObj._skipColor, copier,
+					scaledImageRect.width(), scaledImageRect.height(), copier);
+				if (celObj.canCacheScaledCopy()) {
+					celObj.putScaledCopyInCache(key, _sourceBuffer);
+				}
+			}
 
 			// Set _valuesX and _valuesY to reference the scaled image without additional scaling
 			for (int16 x = targetRect.left; x < targetRect.right; ++x) {
@@ -295,7 +312,102 @@ struct SCALER_Scale {
 					_valuesY[y] = table.valuesY[y - scaledPosition.y];
 				}
 			}
+
+			// Uncompressed cels are already read straight from the resource,
+			// and may be truncated, so only compressed ones are copied
+			if (celObj._compressionType == kCelCompressionRLE && celObj.canCacheScaledCopy()) {
+				useScaledCopy(celObj, targetRect, scaledPosition, scaleX, scaleY, table, useGlobalScaling);
+			}
+		}
+	}
+
+	/**
+	 * Once a cel has been drawn twice with the same scaling, draws it from a
+	 * cached scaled copy, so that every row is read contiguously instead of
+	 * being decompressed and gathered through the lookup tables. The copy
+	 * holds exactly the pixels the lookup tables would select, starting at
+	 * scaledPosition.
+	 */
+	void useScaledCopy(const CelObj &celObj, const Common::Rect &targetRect, const Common::Point &scaledPosition, const Ratio &scaleX, const Ratio &scaleY, const CelScalerTable &table, const bool useGlobalScaling) {
+		ScaledCelKey key;
+		key.info = celObj._info;
+		key.scaleX = scaleX;
+		key.scaleY = scaleY;
+		key.position = useGlobalScaling ? scaledPosition : Common::Point();
+		key.mirrorX = FLIP;
+
+		bool seen;
+		Common::SharedPtr<Buffer> copy = celObj.searchScaledCache(key, seen);
+		if (!copy) {
+			if (seen) {
+				copy = createScaledCopy(celObj, scaledPosition, scaleX, scaleY, table, useGlobalScaling);
+			}
+
+			// Without a copy, the entry only records that the key was seen
+			celObj.putScaledCopyInCache(key, copy);
+			if (!copy) {
+				return;
+			}
+		}
+
+		const Common::Rect copyRect(scaledPosition.x, scaledPosition.y, scaledPosition.x + copy->w, scaledPosition.y + copy->h);
+		if (!copyRect.contains(targetRect)) {
+			return;
+		}
+
+		_sourceBuffer = copy;
+		for (int16 x = targetRect.left; x < targetRect.right; ++x) {
+			_valuesX[x] = x - scaledPosition.x;
+		}
+		for (int16 y = targetRect.top; y < targetRect.bottom; ++y) {
+			_valuesY[y] = y - scaledPosition.y;
+		}
+	}
+
+	/**
+	 * Creates a scaled copy covering every column and row from scaledPosition
+	 * on for which the lookup tables select a source pixel inside the cel.
+	 */
+	Common::SharedPtr<Buffer> createScaledCopy(const CelObj &celObj, const Common::Point &scaledPosition, const Ratio &scaleX, const Ratio &scaleY, const CelScalerTable &table, const bool useGlobalScaling) {
+		const int16 unscaledX = useGlobalScaling ? (scaledPosition.x / scaleX).toInt() : 0;
+		const int16 unscaledY = useGlobalScaling ? (scaledPosition.y / scaleY).toInt() : 0;
+		const int16 startX = useGlobalScaling ? scaledPosition.x : 0;
+		const int16 startY = useGlobalScaling ? scaledPosition.y : 0;
+
+		int16 width = 0;
+		while (startX + width >= 0 && startX + width < kCelScalerTableSize) {
+			const int value = table.valuesX[startX + width] - unscaledX;
+			if (value < 0 || value >= celObj._width) {
+				break;
+			}
+			_copyColumns[width] = FLIP ? celObj._width - 1 - value : value;
+			++width;
+		}
+
+		int16 height = 0;
+		while (startY + height >= 0 && startY + height < kCelScalerTableSize) {
+			const int value = table.valuesY[startY + height] - unscaledY;
+			if (value < 0 || value >= celObj._height) {
+				break;
+			}
+			++height;
+		}
+
+		if (width == 0 || height == 0 || (uint32)width * height > kScaledCelCacheBudget) {
+			return Common::SharedPtr<Buffer>();
+		}
+
+		Common::SharedPtr<Buffer> copy(new Buffer(), Graphics::SurfaceDeleter());
+		copy->create(width, height, Graphics::PixelFormat::createFormatCLUT8());
+		for (int16 y = 0; y < height; ++y) {
+			const byte *source = _reader.getRow(table.valuesY[startY + y] - unscaledY);
+			byte *target = static_cast<byte *>(copy->getBasePtr(0, y));
+			for (int16 x = 0; x < width; ++x) {
+				target[x] = source[_copyColumns[x]];
+			}
 		}
+
+		return copy;
 	}
 
 	inline void setTarget(const int16 x, const int16 y) {
@@ -320,6 +432,8 @@ template<bool FLIP, typename READER>
 int16 SCALER_Scale<FLIP, READER>::_valuesX[kCelScalerTableSize];
 template<bool FLIP, typename READER>
 int16 SCALER_Scale<FLIP, READER>::_valuesY[kCelScalerTableSize];
+template<bool FLIP, typename READER>
+int16 SCALER_Scale<FLIP, READER>::_copyColumns[kCelScalerTableSize];
 
 #pragma mark -
 #pragma mark CelObj - Resource readers
@@ -739,6 +853,70 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	entry.id = ++_nextCacheId;
 }
 
+ScaledCelCache *CelObj::_scaledCache = nullptr;
+uint32 CelObj::_scaledCacheSize = 0;
+
+Common::SharedPtr<Buffer> CelObj::searchScaledCache(const ScaledCelKey &key, bool &seen) const {
+	for (uint i = 0; i < _scaledCache->size(); ++i) {
+		ScaledCelCacheEntry &entry = (*_scaledCache)[i];
+		if (entry.key == key) {
+			entry.id = ++_nextCacheId;
+			seen = true;
+			return entry.buffer;
+		}
+	}
+
+	seen = false;
+	return Common::SharedPtr<Buffer>();
+}
+
+void CelObj::putScaledCopyInCache(const ScaledCelKey &key, const Common::SharedPtr<Buffer> &buffer) const {
+	if (!canCacheScaledCopy()) {
+		return;
+	}
+
+	const uint32 size = buffer ? buffer->w * buffer->h : 0;
+	if (size > kScaledCelCacheBudget) {
+		return;
+	}
+
+	// Replace an entry for the same key, which only recorded that the key
+	// had been seen
+	for (uint i = 0; i < _scaledCache->size(); ++i) {
+		ScaledCelCacheEntry &entry = (*_scaledCache)[i];
+		if (entry.key == key) {
+			if (entry.buffer) {
+				_scaledCacheSize -= entry.buffer->w * entry.buffer->h;
+			}
+			_scaledCache->remove_at(i);
+			break;
+		}
+	}
+
+	// Evict the least recently used entries until the new copy fits
+	while (!_scaledCache->empty() && (_scaledCacheSize + size > kScaledCelCacheBudget || _scaledCache->size() >= kScaledCelCacheMaxEntries)) {
+		uint oldestIndex = 0;
+		for (uint i = 1; i < _scaledCache->size(); ++i) {
+			if ((*_scaledCache)[i].id < (*_scaledCache)[oldestIndex].id) {
+				oldestIndex = i;
+			}
+		}
+
+		const Common::SharedPtr<Buffer> &oldest = (*_scaledCache)[oldestIndex].buffer;
+		if (oldest) {
+			_scaledCacheSize -= oldest->w * oldest->h;
+		}
+		_scaledCache->remove_at(oldestIndex);
+	}
+
+	ScaledCelCacheEntry entry;
+	entry.id = ++_nextCacheId;
+	entry.key = key;
+	entry.buffer = buffer;
+	_scaledCache->push_back(entry);
+	_scaledCacheSize += size;
+}
+
 #pragma mark -
 #pragma mark CelObj - Drawing
 
@@ -105,7 +105,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -148,6 +148,77 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+/**
+ * Identifies a scaled copy of a cel in the scaled cel cache.
+ */
+struct ScaledCelKey {
+	CelInfo32 info;
+
+	/**
+	 * Whether the copy was scaled with LarryScale instead of the default
+	 * scaler.
+	 */
+	bool larryScale;
+
+	Ratio scaleX;
+	Ratio scaleY;
+
+	/**
+	 * The scaled position of the cel, if it affects which source pixels are
+	 * read (the global scaling mode of the default scaler). Otherwise (0, 0).
+	 */
+	Common::Point position;
+
+	/**
+	 * Whether the cel is drawn mirrored. The default scaler follows the
+	 * scaling cadence from the left edge, so a mirrored copy is not simply
+	 * the unmirrored copy read backwards.
+	 */
+	bool mirrorX;
+
+	ScaledCelKey() : larryScale(false), mirrorX(false) {}
+
+	inline bool operator==(const ScaledCelKey &other) const {
+		return info == other.info &&
+			larryScale == other.larryScale &&
+			scaleX == other.scaleX &&
+			scaleY == other.scaleY &&
+			position == other.position &&
+			mirrorX == other.mirrorX;
+	}
+};
+
+struct ScaledCelCacheEntry {
+	/**
+	 * A monotonically increasing cache ID used to identify the least recently
+	 * used item in the cache for replacement.
+	 */
+	int id;
+	ScaledCelKey key;
+
+	/**
+	 * The scaled copy. Null if the cel has only been drawn once with this key
+	 * so far.
+	 */
+	Common::SharedPtr<Buffer> buffer;
+	ScaledCelCacheEntry() : id(0) {}
+};
+
+typedef Common::Array<ScaledCelCacheEntry> ScaledCelCache;
+
+enum {
+	/**
+	 * The maximum number of bytes of pixel data kept in the scaled cel cache.
+	 */
+	kScaledCelCacheBudget = 4 * 1024 * 1024,
+
+	/**
+	 * The maximum number of entries in the scaled cel cache, including the
+	 * ones without a scaled copy yet.
+	 */
+	kScaledCelCacheMaxEntries = 128
+};
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -474,6 +545,43 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+	/**
+	 * A cache of scaled copies of cels. Screen items usually keep the same
+	 * cel and scale for many frames. Scaling a cel with LarryScale is far
+	 * more expensive than drawing it, and the default scaler has to
+	 * decompress and gather the source pixels of every row it draws.
+	 */
+	static ScaledCelCache *_scaledCache;
+
+	/**
+	 * The number of bytes of pixel data currently held by the scaled cel
+	 * cache.
+	 */
+	static uint32 _scaledCacheSize;
+
+public:
+	/**
+	 * Whether scaled copies of this cel may be cached. Cels which are drawn
+	 * from memory bitmaps are not cached, as their contents may change.
+	 */
+	bool canCacheScaledCopy() const {
+		return _info.type == kCelTypeView || _info.type == kCelTypePic;
+	}
+
+	/**
+	 * Searches the scaled cel cache for the given key. Returns a null pointer
+	 * if there is no scaled copy; `seen` tells whether the key was looked up
+	 * before.
+	 */
+	Common::SharedPtr<Buffer> searchScaledCache(const ScaledCelKey &key, bool &seen) const;
+
+	/**
+	 * Puts a scaled copy of this cel (or, with a null buffer, a note that the
+	 * key has been seen) into the scaled cel cache, evicting the least
+	 * recently used entries if the cache is over budget.
+	 */
+	void putScaledCopyInCache(const ScaledCelKey &key, const Common::SharedPtr<Buffer> &buffer) const;
 };
 
 #pragma mark -
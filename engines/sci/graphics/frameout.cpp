@@ -499,12 +499,18 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		remapMarkRedraw();
 	}
 
+	uint32 stageStartTime = g_system->getMillis();
+
 	calcLists(_screenItemLists, eraseLists, eraseRect);
 
 	for (ScreenItemListList::iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
 		list->sort();
 	}
 
+	uint32 now = g_system->getMillis();
+	_frameTimings.calcLists += now - stageStartTime;
+	stageStartTime = now;
+
 	for (ScreenItemListList::iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
 		for (DrawList::iterator drawItem = list->begin(); drawItem != list->end(); ++drawItem) {
 			(*drawItem)->screenItem->getCelObj().submitPalette();
@@ -513,10 +519,10 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 
 	_remapOccurred = _palette->updateForFrame();
 
-	for (PlaneList::size_type i = 0; i < _planes.size(); ++i) {
-		drawEraseList(eraseLists[i], *_planes[i]);
-		drawScreenItemList(_screenItemLists[i]);
-	}
+	composeFrame(eraseLists, _screenItemLists);
+
+	now = g_system->getMillis();
+	_frameTimings.draw += now - stageStartTime;
 
 	if (robotIsActive) {
 		robotPlayer.frameAlmostVisible();
@@ -525,9 +531,13 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 	_palette->updateHardware();
 
 	if (shouldShowBits) {
+		stageStartTime = g_system->getMillis();
 		showBits();
+		_frameTimings.showBits += g_system->getMillis() - stageStartTime;
 	}
 
+	++_frameTimings.frames;
+
 	if (robotIsActive) {
 		robotPlayer.frameNowVisible();
 	}
@@ -1017,6 +1027,118 @@ void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 	}
 }
 
+void GfxFrameout::composeFrame(const EraseListList &eraseLists, const ScreenItemListList &drawLists) {
+	// Black lines are drawn relative to the top of each drawn rect, so
+	// clipping such a screen item to a region would move them
+	for (PlaneList::size_type i = 0; i < _planes.size(); ++i) {
+		for (DrawList::size_type j = 0; j < drawLists[i].size(); ++j) {
+			if (drawLists[i][j]->screenItem->_drawBlackLines) {
+				for (PlaneList::size_type k = 0; k < _planes.size(); ++k) {
+					drawEraseList(eraseLists[k], *_planes[k]);
+					drawScreenItemList(drawLists[k]);
+				}
+				return;
+			}
+		}
+	}
+
+	_compositionOps.clear();
+	for (PlaneList::size_type i = 0; i < _planes.size(); ++i) {
+		const Plane &plane = *_planes[i];
+		if (plane._type == kPlaneTypeColored) {
+			const RectList &eraseList = eraseLists[i];
+			for (RectList::size_type j = 0; j < eraseList.size(); ++j) {
+				mergeToShowList(*eraseList[j], _showList, _overdrawThreshold);
+
+				CompositionOp op;
+				op.rect = *eraseList[j];
+				op.screenItem = nullptr;
+				op.color = plane._back;
+				_compositionOps.push_back(op);
+			}
+		}
+
+		const DrawList &drawList = drawLists[i];
+		for (DrawList::size_type j = 0; j < drawList.size(); ++j) {
+			mergeToShowList(drawList[j]->rect, _showList, _overdrawThreshold);
+
+			CompositionOp op;
+			op.rect = drawList[j]->rect;
+			op.screenItem = drawList[j]->screenItem;
+			op.color = 0;
+			_compositionOps.push_back(op);
+		}
+	}
+
+	// The show list covers everything drawn in this frame. Its rects are
+	// normally disjoint already; the draw rects are added too in case the
+	// merging ever leaves a part uncovered.
+	_compositionRegions.clear();
+	for (RectList::size_type i = 0; i < _showList.size(); ++i) {
+		if (_showList[i] != nullptr) {
+			addCompositionRegion(*_showList[i]);
+		}
+	}
+	for (uint i = 0; i < _compositionOps.size(); ++i) {
+		addCompositionRegion(_compositionOps[i].rect);
+	}
+
+	// Each region could be handed to a worker thread, but CelObj keeps its
+	// scaler tables and caches in static data, so they are drawn in turn
+	for (uint i = 0; i < _compositionRegions.size(); ++i) {
+		composeRegion(_compositionRegions[i]);
+	}
+}
+
+void GfxFrameout::addCompositionRegion(const Common::Rect &rect) {
+	if (rect.isEmpty()) {
+		return;
+	}
+
+	const uint numRegions = _compositionRegions.size();
+	Common::Array<Common::Rect> pieces;
+	pieces.push_back(rect);
+	for (uint i = 0; i < numRegions && !pieces.empty(); ++i) {
+		for (uint j = 0; j < pieces.size(); ) {
+			Common::Rect outRects[4];
+			const int splitCount = splitRects(pieces[j], _compositionRegions[i], outRects);
+			if (splitCount == -1) {
+				++j;
+				continue;
+			}
+
+			pieces.remove_at(j);
+			for (int k = 0; k < splitCount; ++k) {
+				pieces.insert_at(j++, outRects[k]);
+			}
+		}
+	}
+
+	for (uint i = 0; i < pieces.size(); ++i) {
+		if (!pieces[i].isEmpty()) {
+			_compositionRegions.push_back(pieces[i]);
+		}
+	}
+}
+
+void GfxFrameout::composeRegion(const Common::Rect &region) {
+	for (uint i = 0; i < _compositionOps.size(); ++i) {
+		const CompositionOp &op = _compositionOps[i];
+		if (!op.rect.intersects(region)) {
+			continue;
+		}
+
+		const Common::Rect rect = op.rect.findIntersectingRect(region);
+		if (op.screenItem == nullptr) {
+			_currentBuffer.fillRect(rect, op.color);
+		} else {
+			const ScreenItem &screenItem = *op.screenItem;
+			CelObj &celObj = *screenItem._celObj;
+			celObj.draw(_currentBuffer, screenItem, rect, screenItem._mirrorX ^ celObj._mirrorX);
+		}
+	}
+}
+
 void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
 	RectList mergeList;
 	Common::Rect merged;
@@ -1457,6 +1579,18 @@ void GfxFrameout::printPlaneListInternal(Console *con, const PlaneList &planeLis
 	}
 }
 
+void GfxFrameout::printFrameTimings(Console *con) const {
+	const FrameTimings &timings = _frameTimings;
+	con->debugPrintf("Frames: %u\n", timings.frames);
+	if (!timings.frames) {
+		return;
+	}
+
+	con->debugPrintf("calcLists: %u ms total, %.2f ms per frame\n", timings.calcLists, (float)timings.calcLists / timings.frames);
+	con->debugPrintf("draw:      %u ms total, %.2f ms per frame\n", timings.draw, (float)timings.draw / timings.frames);
+	con->debugPrintf("showBits:  %u ms total, %.2f ms per frame\n", timings.showBits, (float)timings.showBits / timings.frames);
+}
+
 void GfxFrameout::printPlaneList(Console *con) const {
 	printPlaneListInternal(con, _planes);
 }
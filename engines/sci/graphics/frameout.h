@@ -334,6 +334,28 @@ private:
 	 */
 	ScreenItemListList _screenItemLists;
 
+	/**
+	 * A fill of an erase rect or a draw of a screen item during the
+	 * composition stage of `frameOut`.
+	 */
+	struct CompositionOp {
+		Common::Rect rect;
+
+		/**
+		 * The screen item to draw, or null to fill `rect` with `color`.
+		 */
+		const ScreenItem *screenItem;
+		uint8 color;
+	};
+
+	/**
+	 * The fills and draws of the current frame in drawing order, and the
+	 * disjoint regions of the screen they are drawn in. These are fields to
+	 * avoid reallocating the arrays on every frame.
+	 */
+	Common::Array<CompositionOp> _compositionOps;
+	Common::Array<Common::Rect> _compositionRegions;
+
 	/**
 	 * The amount of extra overdraw that is acceptable when merging two show
 	 * list rectangles together into a single larger rectangle.
@@ -374,6 +396,28 @@ private:
 	 */
 	void drawScreenItemList(const DrawList &screenItemList);
 
+	/**
+	 * Draws the erase and draw lists of all planes, like calling
+	 * `drawEraseList` and `drawScreenItemList` for each plane in turn. The
+	 * show list is split into disjoint regions, and every region is drawn
+	 * separately with the fills and draws clipped to it, in their original
+	 * order. The result is identical to drawing the lists directly.
+	 */
+	void composeFrame(const EraseListList &eraseLists, const ScreenItemListList &drawLists);
+
+	/**
+	 * Adds the parts of `rect` that are not covered by any composition region
+	 * yet as new regions.
+	 */
+	void addCompositionRegion(const Common::Rect &rect);
+
+	/**
+	 * Draws all composition operations clipped to the given region. Regions
+	 * do not overlap and this only writes pixels inside the region, so
+	 * regions can be drawn in any order.
+	 */
+	void composeRegion(const Common::Rect &region);
+
 	/**
 	 * Adds a new rectangle to the list of regions to write out to the hardware.
 	 * The provided rect may be merged into an existing rectangle to reduce the
@@ -436,6 +480,21 @@ private:
 #pragma mark -
 #pragma mark Debugging
 public:
+	/**
+	 * Accumulated time spent in the stages of `frameOut`, in milliseconds.
+	 */
+	struct FrameTimings {
+		uint32 frames;
+		uint32 calcLists;
+		uint32 draw;
+		uint32 showBits;
+
+		FrameTimings() : frames(0), calcLists(0), draw(0), showBits(0) {}
+	};
+
+	FrameTimings _frameTimings;
+
+	void printFrameTimings(Console *con) const;
 	void printPlaneList(Console *con) const;
 	void printVisiblePlaneList(Console *con) const;
 	void printPlaneListInternal(Console *con, const PlaneList &planeList) const;
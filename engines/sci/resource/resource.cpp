@@ -25,6 +25,7 @@
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #ifdef ENABLE_SCI32
@@ -210,6 +211,8 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : SciSpan<const byte>
 	_source = nullptr;
 	_header = nullptr;
 	_headerSize = 0;
+	_lruProtected = false;
+	_lruReferenced = false;
 }
 
 Resource::~Resource() {
@@ -225,6 +228,7 @@ void Resource::unalloc() {
 	delete[] _header;
 	_header = nullptr;
 	_status = kResStatusNoMalloc;
+	_lruReferenced = false;
 }
 
 void Resource::writeToStream(Common::WriteStream *stream) const {
@@ -1007,7 +1011,10 @@ void ResourceManager::init() {
 	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_memoryProtected = 0;
 	_LRU.clear();
+	_protectedLRU.clear();
+	_cacheStats.reset();
 	_resMap.clear();
 	_audioMapSCI1 = nullptr;
 #ifdef ENABLE_SCI32
@@ -1081,6 +1088,15 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// Allow the budget to be tuned per game, e.g. for low-memory ports
+	if (!_detectionMode && ConfMan.hasKey("resource_cache_size")) {
+		const int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0)
+			_maxMemoryLRU = cacheSize * 1024;
+		else
+			warning("Ignoring invalid resource_cache_size %d", cacheSize);
+	}
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1127,7 +1143,13 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	if (res->_lruProtected) {
+		_protectedLRU.erase(res->_lruPosition);
+		_memoryProtected -= res->size();
+		res->_lruProtected = false;
+	} else {
+		_LRU.erase(res->_lruPosition);
+	}
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1137,7 +1159,31 @@ void ResourceManager::addToLRU(Resource *res) {
 		warning("resMan: trying to enqueue resource with state %d", res->_status);
 		return;
 	}
-	_LRU.push_front(res);
+	if (res->_lruReferenced) {
+		// Resources which have been requested again while cached go to
+		// the protected segment, which may take up to 3/4 of the budget.
+		// Anything pushed out of it gets a second chance in the
+		// probationary segment.
+		_protectedLRU.push_front(res);
+		res->_lruPosition = _protectedLRU.begin();
+		res->_lruProtected = true;
+		_memoryProtected += res->size();
+
+		// Never demote the resource just added, which is at the front.
+		// Comparing with it avoids List::size(), which walks the list.
+		const int maxMemoryProtected = _maxMemoryLRU / 4 * 3;
+		while (_memoryProtected > maxMemoryProtected && _protectedLRU.back() != res) {
+			Resource *demoted = _protectedLRU.back();
+			_protectedLRU.pop_back();
+			_memoryProtected -= demoted->size();
+			demoted->_lruProtected = false;
+			_LRU.push_front(demoted);
+			demoted->_lruPosition = _LRU.begin();
+		}
+	} else {
+		_LRU.push_front(res);
+		res->_lruPosition = _LRU.begin();
+	}
 	_memoryLRU += res->size();
 #ifdef SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1149,16 +1195,22 @@ void ResourceManager::addToLRU(Resource *res) {
 
 void ResourceManager::freeOldResources() {
 	while (_maxMemoryLRU < _memoryLRU) {
-		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
+		assert(!_LRU.empty() || !_protectedLRU.empty());
+		Resource *goner = _LRU.empty() ? _protectedLRU.back() : _LRU.back();
 		removeFromLRU(goner);
 		goner->unalloc();
+		++_cacheStats.evictions;
 #ifdef SCI_VERBOSE_RESMAN
 		debug("resMan-debug: LRU: Freeing %s (%d bytes)", goner->_id.toString().c_str(), goner->size);
 #endif
 	}
 }
 
+void ResourceManager::setMaxMemoryLRU(int bytes) {
+	_maxMemoryLRU = bytes;
+	freeOldResources();
+}
+
 Common::List<ResourceId> ResourceManager::listResources(ResourceType type, int mapNumber) {
 	Common::List<ResourceId> resources;
 
@@ -1195,15 +1247,24 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return nullptr;
 
-	if (retval->_status == kResStatusNoMalloc)
+	const ResourceType type = retval->getType();
+	if (retval->_status == kResStatusNoMalloc) {
+		const uint32 startTime = g_system->getMillis();
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
-		// The resource is removed from its current position
-		// in the LRU list because it has been requested
-		// again. Below, it will either be locked, or it
-		// will be added back to the LRU list at the 'most
-		// recent' position.
-		removeFromLRU(retval);
+		_cacheStats.loadTime[type] += g_system->getMillis() - startTime;
+		++_cacheStats.misses[type];
+	} else {
+		++_cacheStats.hits[type];
+		retval->_lruReferenced = true;
+		if (retval->_status == kResStatusEnqueued) {
+			// The resource is removed from its current position
+			// in the LRU list because it has been requested
+			// again. Below, it will either be locked, or it
+			// will be added back to the LRU list at the 'most
+			// recent' position of the protected segment.
+			removeFromLRU(retval);
+		}
+	}
 
 	// Unless an error occurred, the resource is now either
 	// locked or allocated, but never queued or freed.
@@ -312,6 +312,10 @@ protected:
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in the LRU segment list while enqueued */
+	bool _lruProtected; /**< Whether the resource is in the protected LRU segment */
+	bool _lruReferenced; /**< Whether the resource was requested again while cached */
+
 	bool loadPatch(Common::SeekableReadStream *file);
 	bool loadFromPatchFile();
 	bool loadFromWaveFile(Common::SeekableReadStream *file);
@@ -323,6 +327,26 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/**
+ * Per-type counters for the resource cache, reported by the `resource_cache`
+ * debugger command.
+ */
+struct ResourceCacheStatistics {
+	uint32 hits[kResourceTypeInvalid]; ///< Requests served from memory
+	uint32 misses[kResourceTypeInvalid]; ///< Requests which had to load the resource
+	uint32 loadTime[kResourceTypeInvalid]; ///< Time spent loading and decompressing, in ms
+	uint32 evictions; ///< Number of resources freed by the LRU
+
+	ResourceCacheStatistics() { reset(); }
+
+	void reset() {
+		for (int i = 0; i < kResourceTypeInvalid; ++i) {
+			hits[i] = misses[i] = loadTime[i] = 0;
+		}
+		evictions = 0;
+	}
+};
+
 class IntMapResourceSource;
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
@@ -380,6 +404,19 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Sets the amount of memory which may be used by unlocked resources
+	 * before the least valuable ones are freed.
+	 * @param bytes	The new budget, in bytes
+	 */
+	void setMaxMemoryLRU(int bytes);
+	int getMaxMemoryLRU() const { return _maxMemoryLRU; }
+	int getMemoryLRU() const { return _memoryLRU; }
+	int getMemoryProtected() const { return _memoryProtected; }
+	int getMemoryLocked() const { return _memoryLocked; }
+
+	ResourceCacheStatistics &getCacheStatistics() { return _cacheStats; }
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -500,7 +537,18 @@ protected:
 	SourcesList _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
-	Common::List<Resource *> _LRU; ///< Last Resource Used list
+	int _memoryProtected;	///< Amount of LRU bytes in the protected segment
+
+	/**
+	 * The LRU cache is segmented: resources enter the probationary segment
+	 * when first released and are only promoted into the protected segment
+	 * once they have been requested again while cached. Eviction always
+	 * drains the probationary segment first, so large one-shot resources
+	 * (e.g. a room's pic) cannot flush frequently reused ones (e.g. common
+	 * views or audio maps) out of the cache.
+	 */
+	Common::List<Resource *> _LRU; ///< Last Resource Used list (probationary segment)
+	Common::List<Resource *> _protectedLRU; ///< Protected LRU segment
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
 	ResourceSource *_audioMapSCI1; ///< Currently loaded audio map for SCI1
@@ -646,6 +694,8 @@ protected:
 	void addToLRU(Resource *res);
 	void removeFromLRU(Resource *res);
 
+	ResourceCacheStatistics _cacheStats;
+
 	ResourceCompression getViewCompression();
 	ViewType detectViewType();
 	bool hasSci0Voc999();
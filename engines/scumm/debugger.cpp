@@ -39,6 +39,8 @@
 
 namespace Scumm {
 
+extern const char *nameOfResType(ResType type);
+
 void debugC(int channel, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
@@ -111,6 +113,8 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 #endif
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+	registerCmd("strips",    WRAP_METHOD(ScummDebugger, Cmd_Strips));
+	registerCmd("heap",      WRAP_METHOD(ScummDebugger, Cmd_Heap));
 }
 
 void ScummDebugger::preEnter() {
@@ -297,6 +301,9 @@ bool ScummDebugger::Cmd_DiMuse(int argc, const char **argv) {
 		} else if (!strcmp(argv[1], "groups") || !strcmp(argv[1], "vols")) {
 			_vm->_imuseDigital->listGroups();
 			return true;
+		} else if (!strcmp(argv[1], "bundles")) {
+			_vm->_imuseDigital->listBundleCache(argc > 2 && !strcmp(argv[2], "reset"));
+			return true;
 		} else if (!strcmp(argv[1], "getParam")) {
 			if (argc > 3) {
 				int result = _vm->_imuseDigital->diMUSEGetParam(atoi(argv[2]), strtol(argv[3], NULL, 16));
@@ -356,6 +363,7 @@ bool ScummDebugger::Cmd_DiMuse(int argc, const char **argv) {
 	debugPrintf("\thook <soundId> <hookId>          - Set hookId for a sound\n");
 	debugPrintf("\tlist|tracks                      - Display info for every virtual audio track\n");
 	debugPrintf("\tgroups|vols                      - Show volume groups info\n");
+	debugPrintf("\tbundles [reset]                  - Show (or reset) bundle block cache statistics\n");
 	debugPrintf("\tgetParam <soundId> <param>       - Get parameter info from a sound\n");
 	debugPrintf("\tsetParam <soundId> <param> <val> - Set parameter value for a sound (dangerous!)\n");
 	debugPrintf("\n");
@@ -1414,4 +1422,56 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_Strips(int argc, const char **argv) {
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		_vm->_dirtyUploadRects = 0;
+		_vm->_dirtyUploadStrips = 0;
+		_vm->_dirtyUploadPixels = 0;
+		debugPrintf("Dirty strip counters reset\n");
+		return true;
+	}
+
+	debugPrintf("Dirty screen uploads: %u rects covering %u strips, %u pixels\n",
+		_vm->_dirtyUploadRects, _vm->_dirtyUploadStrips, _vm->_dirtyUploadPixels);
+	if (_vm->_dirtyUploadRects)
+		debugPrintf("Average: %u strips, %u pixels per rect\n",
+			_vm->_dirtyUploadStrips / _vm->_dirtyUploadRects, _vm->_dirtyUploadPixels / _vm->_dirtyUploadRects);
+
+	return true;
+}
+
+bool ScummDebugger::Cmd_Heap(int argc, const char **argv) {
+	ResourceManager *res = _vm->_res;
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		res->resetLoadStats();
+		debugPrintf("Resource load statistics reset\n");
+		return true;
+	}
+
+	if (argc > 1) {
+		int size = atoi(argv[1]);
+		if (size <= 0) {
+			debugPrintf("Usage: heap [reset | <max size in KiB>]\n");
+			return true;
+		}
+		res->setHeapThreshold(size * 1024 / 4 * 3, size * 1024);
+	}
+
+	debugPrintf("Heap: %u KiB allocated, expiring from %u KiB down to %u KiB%s\n",
+		res->getHeapSize() / 1024, res->getMaxHeapThreshold() / 1024, res->getMinHeapThreshold() / 1024,
+		res->isCacheMode() ? ", keeping frequent rooms and costumes" : "");
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		const ResourceManager::LoadStats &stats = res->getLoadStats(type);
+		if (stats.loads)
+			debugPrintf("%-12s %5u loads, %8u bytes, %5u ms\n", nameOfResType(type), stats.loads, stats.bytes, stats.loadTime);
+	}
+
+	debugPrintf("Last room change (room %d): %u loads, %u bytes, %u ms\n", res->_lastRoomLoaded,
+		res->_lastRoomLoadStats.loads, res->_lastRoomLoadStats.bytes, res->_lastRoomLoadStats.loadTime);
+
+	return true;
+}
+
 } // End of namespace Scumm
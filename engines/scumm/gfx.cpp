@@ -591,32 +591,52 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	if (vs->h == 0)
 		return;
 
-	int i;
-	int w = 8;
-	int start = 0;
-
-	for (i = 0; i < _gdi->_numStrips; i++) {
-		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+	int start = -1;
+	int top = 0;
+	int bottom = 0;
+
+	// Neighboring dirty strips whose dirty row ranges overlap are coalesced
+	// into one rectangle covering the union of their ranges. The extra rows
+	// are cheap compared to a separate composite and backend upload for
+	// every strip, e.g. for an actor spanning several strips.
+	for (int i = 0; i <= _gdi->_numStrips; i++) {
+		const bool dirty = (i < _gdi->_numStrips) && vs->bdirty[i];
+		int stripTop = 0, stripBottom = 0;
+
+		if (dirty) {
+			stripTop = vs->tdirty[i];
+			stripBottom = vs->bdirty[i];
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
-				w += 8;
+
+			if (start != -1 && stripTop < bottom && stripBottom > top) {
+				top = MIN(top, stripTop);
+				bottom = MAX(bottom, stripBottom);
 				continue;
 			}
+		}
+
+		if (start != -1) {
+			const int w = (i - start) * 8;
 #ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
 			if (_game.platform == Common::kPlatformFMTowns && vs->number == kBannerVirtScreen) {
 				int scl = _textSurfaceMultiplier;
 				towns_drawStripToScreen(vs, start * 8 * scl, (vs->topline + top) * scl, start * 8 * scl, top * scl, w * scl, bottom - top);
-			} else 
+			} else
 #endif
 				drawStripToScreen(vs, start * 8, w, top, bottom);
-			w = 8;
+
+			_dirtyUploadRects++;
+			_dirtyUploadStrips += i - start;
+			_dirtyUploadPixels += w * (bottom - top);
+			start = -1;
+		}
+
+		if (dirty) {
+			start = i;
+			top = stripTop;
+			bottom = stripBottom;
 		}
-		start = i + 1;
 	}
 }
 
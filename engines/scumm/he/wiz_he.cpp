@@ -46,6 +46,8 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_useWizClipRect = false;
 	_uses16BitColor = (_vm->_game.features & GF_16BIT_COLOR);
+	_decompressedWizCacheSize = 0;
+	_decompressedWizCacheClock = 0;
 }
 
 void Wiz::clearWizBuffer() {
@@ -181,6 +183,94 @@ WizPxShrdBuffer Wiz::drawAWizPrim(int globNum, int state, int x, int y, int z, i
 		optionalBitmapOverride, optionalColorConversionTable, 0);
 }
 
+WizPxShrdBuffer Wiz::getDecompressedWiz(int image, int state, int flags, const WizRawPixel *optionalColorConversionTable) {
+	// These change the palette, the remap block or the z-planes as they draw,
+	// so the image has to go through drawAWizPrim() every time...
+	if ((flags & (kWRFUsePalette | kWRFRemap | kWRFPrint | kWRFZPlaneOn | kWRFZPlaneOff)) ||
+		getWizCompressionType(image, state) != kWCTTRLE) {
+		return drawAWizPrim(image, state, 0, 0, 0, 0, 0, nullptr, kWRFAlloc | flags, nullptr, optionalColorConversionTable);
+	}
+
+	// Same default as drawAWizPrimEx()...
+	if (!optionalColorConversionTable && _vm->_game.heversion > 98)
+		optionalColorConversionTable = (WizRawPixel *)_vm->getHEPaletteSlot(1);
+
+	const byte *dataPtr = getWizStateDataPrim(image, state);
+	if (!dataPtr)
+		error("Wiz::getDecompressedWiz(): %d state %d missing data block", image, state);
+
+	const uint32 dataSize = READ_BE_UINT32(dataPtr + 4);
+	const int transparentColor = _vm->_game.heversion < 95 ? 0x05 : _vm->VAR(_vm->VAR_WIZ_TRANSPARENT_COLOR);
+
+	// The conversion table is only read when drawing in 16-bit color...
+	const uint32 tableSize = (_uses16BitColor && optionalColorConversionTable) ? 256 * sizeof(WizRawPixel16) : 0;
+
+	for (uint i = 0; i < _decompressedWizCache.size(); i++) {
+		DecompressedWiz &entry = _decompressedWizCache[i];
+
+		if (entry.image != image || entry.state != state || entry.flags != flags ||
+			entry.transparentColor != transparentColor ||
+			entry.compressedData.size() != dataSize || entry.conversionTable.size() != tableSize) {
+			continue;
+		}
+
+		if (memcmp(entry.compressedData.data(), dataPtr, dataSize) ||
+			(tableSize && memcmp(entry.conversionTable.data(), optionalColorConversionTable, tableSize))) {
+			// The image has been rewritten since, this copy is stale...
+			_decompressedWizCacheSize -= entry.size;
+			_decompressedWizCache.remove_at(i);
+			break;
+		}
+
+		entry.lastUse = ++_decompressedWizCacheClock;
+		return entry.bufferPtr;
+	}
+
+	WizPxShrdBuffer bufferPtr = drawAWizPrim(image, state, 0, 0, 0, 0, 0, nullptr, kWRFAlloc | flags, nullptr, optionalColorConversionTable);
+	if (!bufferPtr())
+		return bufferPtr;
+
+	int32 width, height;
+	getWizImageDim(image, state, width, height);
+
+	const uint32 size = width * height * (_uses16BitColor ? sizeof(WizRawPixel16) : sizeof(WizRawPixel8)) + dataSize + tableSize;
+	if (size > kDecompressedWizCacheMaxSize / 4)
+		return bufferPtr;
+
+	// Make room by dropping the least recently drawn images...
+	while (!_decompressedWizCache.empty() &&
+		(_decompressedWizCache.size() >= kDecompressedWizCacheMaxEntries ||
+		 _decompressedWizCacheSize + size > kDecompressedWizCacheMaxSize)) {
+		uint oldest = 0;
+		for (uint i = 1; i < _decompressedWizCache.size(); i++) {
+			if (_decompressedWizCache[i].lastUse < _decompressedWizCache[oldest].lastUse)
+				oldest = i;
+		}
+
+		_decompressedWizCacheSize -= _decompressedWizCache[oldest].size;
+		_decompressedWizCache.remove_at(oldest);
+	}
+
+	DecompressedWiz entry;
+	entry.image = image;
+	entry.state = state;
+	entry.flags = flags;
+	entry.transparentColor = transparentColor;
+	entry.compressedData.resize(dataSize);
+	memcpy(entry.compressedData.data(), dataPtr, dataSize);
+	entry.conversionTable.resize(tableSize);
+	if (tableSize)
+		memcpy(entry.conversionTable.data(), optionalColorConversionTable, tableSize);
+	entry.bufferPtr = bufferPtr;
+	entry.size = size;
+	entry.lastUse = ++_decompressedWizCacheClock;
+
+	_decompressedWizCache.push_back(entry);
+	_decompressedWizCacheSize += size;
+
+	return bufferPtr;
+}
+
 WizPxShrdBuffer Wiz::drawAWizPrimEx(int globNum, int state, int x, int y, int z, int shadowImage, int zbufferImage, const Common::Rect *optionalClipRect, int flags, WizSimpleBitmap *optionalBitmapOverride, const WizRawPixel *optionalColorConversionTable, const WizImageCommand *optionalICmdPtr) {
 	int destWidth, destHeight, srcWidth, srcHeight, srcComp, remapId;
 	byte *srcData, *srcPtr, *stateHeader, *remapPtr;
@@ -1952,9 +2042,7 @@ void Wiz::handleRotate90SpecialCase(int image, int state, int x, int y, int shad
 	}
 
 	// Get the image from the basic drawing function...
-	srcBitmap.bufferPtr = drawAWizPrim(
-		image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc,
-		0, optionalColorConversionTable);
+	srcBitmap.bufferPtr = getDecompressedWiz(image, state, 0, optionalColorConversionTable);
 
 	srcBitmap.bitmapWidth = w;
 	srcBitmap.bitmapHeight = h;
@@ -24,6 +24,7 @@
 
 //#define WIZ_DEBUG_BUFFERS
 
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace Scumm {
@@ -371,6 +372,26 @@ struct WizSimpleBitmap {
 	}
 };
 
+/**
+ * A TRLE state decompressed by drawAWizPrim() with kWRFAlloc, kept for the
+ * warp and rotation draws which would otherwise decompress it every frame.
+ * The compressed data and the conversion table it was built from are kept
+ * too, since image resources can be rewritten in place without a reload.
+ */
+struct DecompressedWiz {
+	int image;
+	int state;
+	int flags;
+	int transparentColor;
+	Common::Array<byte> compressedData;
+	Common::Array<byte> conversionTable;
+	WizPxShrdBuffer bufferPtr;
+	uint32 size;
+	uint32 lastUse;
+
+	DecompressedWiz() : image(0), state(0), flags(0), transparentColor(0), size(0), lastUse(0) {}
+};
+
 struct WizMultiTypeBitmap {
 	byte *data;
 	int32 width;
@@ -816,6 +837,17 @@ public:
 private:
 	ScummEngine_v71he *_vm;
 
+	enum {
+		kDecompressedWizCacheMaxEntries = 32,
+		kDecompressedWizCacheMaxSize = 4 * 1024 * 1024
+	};
+
+	Common::Array<DecompressedWiz> _decompressedWizCache;
+	uint32 _decompressedWizCacheSize;
+	uint32 _decompressedWizCacheClock;
+
+	WizPxShrdBuffer getDecompressedWiz(int image, int state, int flags, const WizRawPixel *optionalColorConversionTable);
+
 
 public:
 	/* Drawing Primitives
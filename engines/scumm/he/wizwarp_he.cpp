@@ -91,7 +91,7 @@ bool Wiz::warpDrawWizTo4Points(int image, int state, const WarpWizPoint *dstPoin
 	if ((getWizCompressionType(image, state) != kWCTNone) ||
 		(optionalColorConversionTable != nullptr) || (flags & (kWRFHFlip | kWRFVFlip | kWRFRemap))) {
 
-		srcBitmap.bufferPtr = drawAWizPrim(image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc | flags, 0, optionalColorConversionTable);
+		srcBitmap.bufferPtr = getDecompressedWiz(image, state, flags, optionalColorConversionTable);
 
 		if (!srcBitmap.bufferPtr()) {
 			return false;
@@ -420,15 +420,18 @@ void Wiz::warpProcessDrawSpansA(WizSimpleBitmap *dstBitmap, const WizSimpleBitma
 		xStep = drawSpans->xSrcStep;
 		yStep = drawSpans->ySrcStep;
 
-		for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
-			if (!_uses16BitColor) {
+		if (!_uses16BitColor) {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				*dst8++ = *(src8 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset));
-			} else {
+				xOffset += xStep;
+				yOffset += yStep;
+			}
+		} else {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				*dst16++ = *(src16 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset));
+				xOffset += xStep;
+				yOffset += yStep;
 			}
-
-			xOffset += xStep;
-			yOffset += yStep;
 		}
 
 		drawSpans++;
@@ -462,25 +465,30 @@ void Wiz::warpProcessDrawSpansTransparent(WizSimpleBitmap *dstBitmap, const WizS
 		xStep = drawSpans->xSrcStep;
 		yStep = drawSpans->ySrcStep;
 
-		for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
-			if (!_uses16BitColor) {
+		if (!_uses16BitColor) {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				srcColor = *(src8 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset));
 				if (srcColor != transparentColor) {
 					*dst8++ = (WizRawPixel8)srcColor;
 				} else {
 					dst8++;
 				}
-			} else {
+
+				xOffset += xStep;
+				yOffset += yStep;
+			}
+		} else {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				srcColor = *(src16 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset));
 				if (srcColor != transparentColor) {
 					*dst16++ = (WizRawPixel16)srcColor;
 				} else {
 					dst16++;
 				}
-			}
 
-			xOffset += xStep;
-			yOffset += yStep;
+				xOffset += xStep;
+				yOffset += yStep;
+			}
 		}
 
 		drawSpans++;
@@ -734,8 +742,8 @@ void Wiz::warpProcessDrawSpansMixColors(WizSimpleBitmap *dstBitmap, const WizSim
 		xStep = drawSpans->xSrcStep;
 		yStep = drawSpans->ySrcStep;
 
-		for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
-			if (!_uses16BitColor) {
+		if (!_uses16BitColor) {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				srcColor = (*(src8 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset)));
 				if (srcColor != transparentColor) {
 					*dst8 = *(tablePtr + (srcColor * 256) + (*dst8));
@@ -743,15 +751,20 @@ void Wiz::warpProcessDrawSpansMixColors(WizSimpleBitmap *dstBitmap, const WizSim
 				} else {
 					dst8++;
 				}
-			} else {
+
+				xOffset += xStep;
+				yOffset += yStep;
+			}
+		} else {
+			for (int xCounter = drawSpans->dstWidth; --xCounter >= 0;) {
 				srcColor = *(src16 + (sw * WARP_FROM_FRAC(yOffset)) + WARP_FROM_FRAC(xOffset));
 
 				*dst16 = WIZRAWPIXEL_50_50_MIX(WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor), WIZRAWPIXEL_50_50_PREMIX_COLOR(*dst16));
 				dst16++;
-			}
 
-			xOffset += xStep;
-			yOffset += yStep;
+				xOffset += xStep;
+				yOffset += yStep;
+			}
 		}
 
 		drawSpans++;
@@ -37,6 +37,17 @@ BundleDirCache::BundleDirCache(const ScummEngine *vm) : _vm(vm) {
 		_bundleDirCache[fileId].isCompressed = false;
 		_bundleDirCache[fileId].indexTable = nullptr;
 	}
+
+	for (int i = 0; i < kBlockCacheEntries; i++) {
+		_blockCache[i].slot = -1;
+		_blockCache[i].offset = 0;
+		_blockCache[i].outputSize = 0;
+		_blockCache[i].lastUsed = 0;
+		_blockCache[i].data = nullptr;
+	}
+
+	_blockCacheTick = 0;
+	resetBlockCacheStats();
 }
 
 BundleDirCache::~BundleDirCache() {
@@ -44,6 +55,69 @@ BundleDirCache::~BundleDirCache() {
 		free(_bundleDirCache[fileId].bundleTable);
 		free(_bundleDirCache[fileId].indexTable);
 	}
+
+	for (int i = 0; i < kBlockCacheEntries; i++) {
+		free(_blockCache[i].data);
+	}
+}
+
+int32 BundleDirCache::fetchBlock(int slot, int32 offset, byte *dst) {
+	for (int i = 0; i < kBlockCacheEntries; i++) {
+		BlockCacheEntry &entry = _blockCache[i];
+		if (entry.slot == slot && entry.offset == offset) {
+			memcpy(dst, entry.data, DIMUSE_BUN_CHUNK_SIZE);
+			entry.lastUsed = ++_blockCacheTick;
+			_blockCacheHits++;
+			return entry.outputSize;
+		}
+	}
+
+	_blockCacheMisses++;
+	return -1;
+}
+
+void BundleDirCache::storeBlock(int slot, int32 offset, const byte *src, int32 outputSize) {
+	// Take a free entry if there is one, otherwise the least recently used
+	BlockCacheEntry *victim = &_blockCache[0];
+	for (int i = 0; i < kBlockCacheEntries; i++) {
+		BlockCacheEntry &entry = _blockCache[i];
+		if (entry.slot == -1) {
+			victim = &entry;
+			break;
+		}
+		if (entry.lastUsed < victim->lastUsed)
+			victim = &entry;
+	}
+
+	if (victim->slot != -1)
+		_blockCacheEvictions++;
+
+	if (!victim->data) {
+		victim->data = (byte *)malloc(DIMUSE_BUN_CHUNK_SIZE);
+		if (!victim->data)
+			return;
+	}
+
+	memcpy(victim->data, src, DIMUSE_BUN_CHUNK_SIZE);
+	victim->slot = slot;
+	victim->offset = offset;
+	victim->outputSize = outputSize;
+	victim->lastUsed = ++_blockCacheTick;
+}
+
+int BundleDirCache::getBlockCacheUsedEntries() const {
+	int used = 0;
+	for (int i = 0; i < kBlockCacheEntries; i++) {
+		if (_blockCache[i].slot != -1)
+			used++;
+	}
+	return used;
+}
+
+void BundleDirCache::resetBlockCacheStats() {
+	_blockCacheHits = 0;
+	_blockCacheMisses = 0;
+	_blockCacheEvictions = 0;
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -146,6 +220,7 @@ BundleMgr::BundleMgr(const ScummEngine *vm, BundleDirCache *cache) {
 	_lastBlockDecompressedSize = 0;
 	_curSampleId = -1;
 	_fileBundleId = -1;
+	_cacheSlot = -1;
 	_file = new ScummFile(vm);
 	_compInputBuff = nullptr;
 }
@@ -185,6 +260,7 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_cacheSlot = slot;
 	isCompressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -214,6 +290,7 @@ void BundleMgr::close() {
 		_lastBlock = -1;
 		_outputSize = 0;
 		_curSampleId = -1;
+		_cacheSlot = -1;
 		free(_compTable);
 		_compTable = nullptr;
 		free(_compInputBuff);
@@ -350,14 +427,19 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 		for (i = firstBlock; i <= lastBlock; i++) {
 			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
+				int32 blockOffset = _bundleTable[found->index].offset + _compTable[i].offset;
+				_outputSize = _cache->fetchBlock(_cacheSlot, blockOffset, _compOutputBuff);
+				if (_outputSize < 0) {
+					// CMI hack: one more zero byte at the end of input buffer
+					_compInputBuff[_compTable[i].size] = 0;
+					_file->seek(blockOffset, SEEK_SET);
+					_file->read(_compInputBuff, _compTable[i].size);
+					_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+
+					if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
+						error("_outputSize: %d", _outputSize);
+					}
+					_cache->storeBlock(_cacheSlot, blockOffset, _compOutputBuff, _outputSize);
 				}
 				_lastBlock = i;
 			}
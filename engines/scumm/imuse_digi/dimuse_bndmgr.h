@@ -53,6 +53,29 @@ private:
 		IndexNode *indexTable;
 	} _bundleDirCache[4];
 
+	/**
+	 * Decompressed blocks, shared by every BundleMgr using this directory
+	 * cache, so that seeking or looping a track (or reopening it on a
+	 * music transition) doesn't decompress the same blocks again.
+	 * Each block is identified by its bundle slot and file offset.
+	 */
+	enum {
+		kBlockCacheEntries = 64 // 64 * DIMUSE_BUN_CHUNK_SIZE = 512 KiB
+	};
+
+	struct BlockCacheEntry {
+		int slot;
+		int32 offset;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte *data;
+	} _blockCache[kBlockCacheEntries];
+
+	uint32 _blockCacheTick;
+	uint32 _blockCacheHits;
+	uint32 _blockCacheMisses;
+	uint32 _blockCacheEvictions;
+
 	const ScummEngine *_vm;
 public:
 	BundleDirCache(const ScummEngine *vm);
@@ -63,6 +86,20 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	/**
+	 * Copy a cached decompressed block into dst (DIMUSE_BUN_CHUNK_SIZE
+	 * bytes). Returns the decompressed size, or -1 if the block isn't cached.
+	 */
+	int32 fetchBlock(int slot, int32 offset, byte *dst);
+	void storeBlock(int slot, int32 offset, const byte *src, int32 outputSize);
+
+	uint32 getBlockCacheHits() const { return _blockCacheHits; }
+	uint32 getBlockCacheMisses() const { return _blockCacheMisses; }
+	uint32 getBlockCacheEvictions() const { return _blockCacheEvictions; }
+	int getBlockCacheUsedEntries() const;
+	int getBlockCacheMaxEntries() const { return kBlockCacheEntries; }
+	void resetBlockCacheStats();
 };
 
 class BundleMgr {
@@ -88,6 +125,7 @@ private:
 	bool _compTableLoaded;
 	bool _isUncompressed;
 	int _fileBundleId;
+	int _cacheSlot;
 	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
 	int _outputSize;
@@ -1119,4 +1119,22 @@ void IMuseDigital::listGroups() {
 	_vm->getDebugger()->debugPrintf("\tMUSICEFF: %3d\n\n", _groupsHandler->getGroupVol(DIMUSE_GROUP_MUSICEFF));
 }
 
+void IMuseDigital::listBundleCache(bool reset) {
+	BundleDirCache *cache = _filesHandler->getSoundMgr()->getBundleDirCache();
+
+	if (reset) {
+		cache->resetBlockCacheStats();
+		_vm->getDebugger()->debugPrintf("Bundle block cache statistics reset.\n\n");
+		return;
+	}
+
+	uint32 hits = cache->getBlockCacheHits();
+	uint32 lookups = hits + cache->getBlockCacheMisses();
+	_vm->getDebugger()->debugPrintf("Bundle block cache:\n");
+	_vm->getDebugger()->debugPrintf("\tEntries:   %d/%d (%d KiB)\n", cache->getBlockCacheUsedEntries(), cache->getBlockCacheMaxEntries(),
+		cache->getBlockCacheMaxEntries() * DIMUSE_BUN_CHUNK_SIZE / 1024);
+	_vm->getDebugger()->debugPrintf("\tHits:      %u/%u (%u%%)\n", hits, lookups, lookups ? hits * 100 / lookups : 0);
+	_vm->getDebugger()->debugPrintf("\tEvictions: %u\n\n", cache->getBlockCacheEvictions());
+}
+
 } // End of namespace Scumm
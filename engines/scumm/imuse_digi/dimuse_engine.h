@@ -439,6 +439,7 @@ public:
 	void listCues();
 	void listTracks();
 	void listGroups();
+	void listBundleCache(bool reset);
 };
 
 } // End of namespace Scumm
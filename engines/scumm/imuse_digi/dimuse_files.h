@@ -58,6 +58,7 @@ public:
 	int seek(int soundId, int32 offset, int mode, int bufId);
 	int read(int soundId, uint8 *buf, int32 size, int bufId);
 	IMuseDigiSndBuffer *getBufInfo(int bufId);
+	ImuseDigiSndMgr *getSoundMgr() { return _sound; }
 	int openSound(int soundId);
 	void closeSound(int soundId);
 	void closeAllSounds();
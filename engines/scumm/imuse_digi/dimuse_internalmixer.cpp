@@ -221,6 +221,12 @@ void IMuseDigiInternalMixer::mix(uint8 *srcBuf, int32 inFrameCount, int wordSize
 					// Linear volume quantization from the lookup table
 					rightChannelVolume = _stereoVolumeTable[17 * channelVolume + channelPan];
 					leftChannelVolume = _stereoVolumeTable[17 * channelVolume - channelPan];
+
+					// The amplitude tables for volume 0 are all zeroes, so there
+					// is nothing to add to the mix buffer for a silent track
+					if (!leftChannelVolume && !rightChannelVolume)
+						return;
+
 					if (wordSize == 8) {
 						mixBits8ConvertToStereo(
 							srcBuf,
@@ -254,6 +260,9 @@ void IMuseDigiInternalMixer::mix(uint8 *srcBuf, int32 inFrameCount, int wordSize
 					if (channelVolume >= 17)
 						channelVolume = 16;
 
+					if (!channelVolume)
+						return;
+
 					if (wordSize == 8)
 						ampTable = &_amp8Table[channelVolume * 128];
 					else
@@ -299,34 +308,34 @@ int IMuseDigiInternalMixer::loop(uint8 **destBuffer, int len) {
 		len *= 2;
 
 	if (!_stereoReverseFlag || _outChannelCount == 1) {
+		// Only one of the two conversions applies; the original code ran the
+		// 8-bit one and then overwrote its output with the 16-bit one
 		if (_outWordSize != 16) {
-			if (len) {
-				for (int i = 0; i < len; i++) {
-					destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i]];
-				}
+			const uint8 *softL8 = (const uint8 *)_softLMID;
+			for (int i = 0; i < len; i++) {
+				destBuffer_tmp[i] = softL8[mixBuffer[i]];
 			}
-		}
-
-		if (len) {
+		} else {
+			const uint16 *softL16 = (const uint16 *)_softLMID;
+			uint16 *dest16 = (uint16 *)destBuffer_tmp;
 			for (int i = 0; i < len; i++) {
-				((uint16 *)destBuffer_tmp)[i] = ((uint16 *)_softLMID)[mixBuffer[i]];
+				dest16[i] = softL16[mixBuffer[i]];
 			}
 		}
 	} else {
 		len /= 2;
 		if (_outWordSize == 16) {
-			if (len) {
-				for (int i = 0; i < len; i += 2) {
-					((uint16 *)destBuffer_tmp)[i]     = ((uint16 *)_softLMID)[mixBuffer[i + 1]];
-					((uint16 *)destBuffer_tmp)[i + 1] = ((uint16 *)_softLMID)[mixBuffer[i]];
-				}
+			const uint16 *softL16 = (const uint16 *)_softLMID;
+			uint16 *dest16 = (uint16 *)destBuffer_tmp;
+			for (int i = 0; i < len; i += 2) {
+				dest16[i]     = softL16[mixBuffer[i + 1]];
+				dest16[i + 1] = softL16[mixBuffer[i]];
 			}
-		}
-
-		if (len) {
+		} else {
+			const uint8 *softL8 = (const uint8 *)_softLMID;
 			for (int i = 0; i < len; i += 2) {
-				destBuffer_tmp[i] = ((uint8 *)_softLMID)[mixBuffer[i + 1]];
-				destBuffer_tmp[i + 1] = ((uint8 *)_softLMID)[mixBuffer[i]];
+				destBuffer_tmp[i]     = softL8[mixBuffer[i + 1]];
+				destBuffer_tmp[i + 1] = softL8[mixBuffer[i]];
 			}
 		}
 	}
@@ -88,6 +88,7 @@ public:
 	void closeSoundById(int soundId);
 	SoundDesc *findSoundById(int soundId);
 	SoundDesc *getSounds();
+	BundleDirCache *getBundleDirCache() { return _cacheBundleDir; }
 	void scheduleSoundForDeallocation(int soundId);
 
 };
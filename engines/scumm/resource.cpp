@@ -633,7 +633,9 @@ void ScummEngine::ensureResourceLoaded(ResType type, ResId idx) {
 	_resourceAccessMutex.lock();
 #endif
 
+	const uint32 startTime = _system->getMillis();
 	loadResource(type, idx);
+	_res->recordLoad(type, idx, _system->getMillis() - startTime);
 
 	if (_game.version == 5 && type == rtRoom && (int)idx == _roomResource)
 		VAR(VAR_ROOM_FLAG) = 1;
@@ -883,6 +885,7 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_loadCount = 0;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -911,6 +914,8 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_keepFrequentResident = false;
+	_lastRoomLoaded = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -924,6 +929,42 @@ void ResourceManager::setHeapThreshold(int min, int max) {
 	_minHeapThreshold = min;
 }
 
+void ResourceManager::setCacheMode(uint32 budget) {
+	setHeapThreshold(budget / 4 * 3, budget);
+	_keepFrequentResident = true;
+}
+
+void ResourceManager::recordLoad(ResType type, ResId idx, uint32 loadTime) {
+	Resource &res = _types[type][idx];
+	if (!res._address)
+		return;
+
+	if (res._loadCount < 0xFF)
+		res._loadCount++;
+
+	_loadStats[type].loads++;
+	_loadStats[type].bytes += res._size;
+	_loadStats[type].loadTime += loadTime;
+}
+
+ResourceManager::LoadStats ResourceManager::getTotalLoadStats() const {
+	LoadStats total;
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		total.loads += _loadStats[type].loads;
+		total.bytes += _loadStats[type].bytes;
+		total.loadTime += _loadStats[type].loadTime;
+	}
+
+	return total;
+}
+
+void ResourceManager::resetLoadStats() {
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1))
+		_loadStats[type] = LoadStats();
+	_lastRoomLoadStats = LoadStats();
+}
+
 bool ResourceManager::validateResource(const char *str, ResType type, ResId idx) const {
 	if (type < rtFirst || type > rtLast || (uint)idx >= (uint)_types[type].size()) {
 		warning("%s Illegal Glob type %s (%d) num %d", str, nameOfResType(type), type, idx);
@@ -1077,10 +1118,51 @@ void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+bool ResourceManager::isFrequentResource(ResType type, ResId idx) const {
+	if (type != rtRoom && type != rtRoomImage && type != rtRoomScripts && type != rtCostume)
+		return false;
+
+	return _types[type][idx]._loadCount >= 2;
+}
+
+bool ResourceManager::findResourceToExpire(bool spareFrequent, ResType &bestType, ResId &bestRes) {
+	int best_score = 0;
+
+	bestType = rtInvalid;
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		if (_types[type]._mode != kDynamicResTypeMode) {
+			// Resources of this type can be reloaded from the data files,
+			// so we can potentially unload them to free memory.
+			ResId idx = _types[type].size();
+			while (idx-- > 0) {
+				Resource &tmp = _types[type][idx];
+				byte counter = tmp.getResourceCounter();
+				if (!tmp.isLocked() && counter >= 2 && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+					if (spareFrequent && isFrequentResource(type, idx))
+						continue;
+
+					// Resources which had to be reloaded before (e.g. the
+					// rooms and costumes of frequently visited places) are
+					// likely to be needed again, so prefer expiring others
+					// of similar age.
+					int score = counter - 8 * MIN<int>(MAX<int>(tmp._loadCount - 1, 0), 8);
+					if (bestType == rtInvalid || score >= best_score) {
+						best_score = score;
+						bestType = type;
+						bestRes = idx;
+					}
+				}
+			}
+		}
+	}
+
+	return bestType != rtInvalid;
+}
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
 	ResType best_type;
-	int best_res = 0;
+	ResId best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1094,27 +1176,10 @@ void ResourceManager::expireResources(uint32 size) {
 	oldAllocatedSize = _allocatedSize;
 
 	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
-				}
-			}
-		}
-
-		if (!best_type)
+		// In the cache mode, frequently used rooms and costumes only go
+		// when nothing else is left to expire
+		if (!findResourceToExpire(_keepFrequentResident, best_type, best_res) &&
+			!(_keepFrequentResident && findResourceToExpire(false, best_type, best_res)))
 			break;
 		nukeResource(best_type, best_res);
 	} while (size + _allocatedSize > _minHeapThreshold);
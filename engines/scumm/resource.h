@@ -125,6 +125,13 @@ public:
 		 */
 		uint32 _roomoffs;
 
+		/**
+		 * How many times this resource has been loaded from the game data
+		 * files. Resources which keep getting reloaded after being expired
+		 * are expired later than others of the same age.
+		 */
+		byte _loadCount;
+
 	public:
 		Resource();
 		~Resource();
@@ -170,17 +177,56 @@ public:
 	};
 	ResTypeData _types[rtLast + 1];
 
+	/**
+	 * Statistics about resources loaded from the game data files, shown by
+	 * the "heap" debugger command.
+	 */
+	struct LoadStats {
+		uint32 loads;
+		uint32 bytes;
+		uint32 loadTime; ///< Time spent loading, in ms
+
+		LoadStats() : loads(0), bytes(0), loadTime(0) {}
+	};
+
 protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
 
+	/**
+	 * When set, rooms and costumes which had to be reloaded before are only
+	 * expired once nothing else can be, see setCacheMode().
+	 */
+	bool _keepFrequentResident;
+
+	LoadStats _loadStats[rtLast + 1];
+
 public:
 	ResourceManager(ScummEngine *vm);
 	~ResourceManager();
 
 	void setHeapThreshold(int min, int max);
+
+	/**
+	 * Switch to the budgeted cache mode: the heap may grow to budget bytes,
+	 * and the rooms and costumes of frequently visited places stay resident
+	 * for as long as other resources can be expired instead.
+	 */
+	void setCacheMode(uint32 budget);
+	bool isCacheMode() const { return _keepFrequentResident; }
 	uint32 getHeapSize() { return _allocatedSize; }
+	uint32 getMinHeapThreshold() const { return _minHeapThreshold; }
+	uint32 getMaxHeapThreshold() const { return _maxHeapThreshold; }
+
+	void recordLoad(ResType type, ResId idx, uint32 loadTime);
+	const LoadStats &getLoadStats(ResType type) const { return _loadStats[type]; }
+	LoadStats getTotalLoadStats() const;
+	void resetLoadStats();
+
+	/** Resources loaded by the most recent room change */
+	LoadStats _lastRoomLoadStats;
+	int _lastRoomLoaded;
 
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
@@ -230,6 +276,8 @@ public:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
 	void expireResources(uint32 size);
+	bool isFrequentResource(ResType type, ResId idx) const;
+	bool findResourceToExpire(bool spareFrequent, ResType &bestType, ResId &bestRes);
 };
 
 } // End of namespace Scumm
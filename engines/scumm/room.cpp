@@ -44,6 +44,9 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 
 	debugC(DEBUG_GENERAL, "Loading room %d", room);
 
+	const ResourceManager::LoadStats loadStatsBefore = _res->getTotalLoadStats();
+	const uint32 startTime = _system->getMillis();
+
 #ifdef ENABLE_SCUMM_7_8
 	if (_game.version >= 7) {
 		((ScummEngine_v7 *)this)->removeBlastTexts();
@@ -252,6 +255,17 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 		}
 	}
 
+	// Remember how much had to be loaded from the data files for this room
+	// change, including the resources required by the entry script
+	const ResourceManager::LoadStats loadStatsAfter = _res->getTotalLoadStats();
+	_res->_lastRoomLoaded = room;
+	_res->_lastRoomLoadStats.loads = loadStatsAfter.loads - loadStatsBefore.loads;
+	_res->_lastRoomLoadStats.bytes = loadStatsAfter.bytes - loadStatsBefore.bytes;
+	_res->_lastRoomLoadStats.loadTime = loadStatsAfter.loadTime - loadStatsBefore.loadTime;
+	debugC(DEBUG_RESOURCE, "Room %d: loaded %d resources (%d bytes) in %d ms, room change took %d ms",
+		room, _res->_lastRoomLoadStats.loads, _res->_lastRoomLoadStats.bytes,
+		_res->_lastRoomLoadStats.loadTime, _system->getMillis() - startTime);
+
 	_doEffect = true;
 
 	// Hint the backend about the virtual keyboard during copy protection screens
@@ -1576,6 +1576,16 @@ void ScummEngine::setupScumm(const Common::Path &macResourceFile) {
 	_res->setHeapThreshold(16 * 1024 * 1024, 32 * 1024 * 1024);
 #endif
 
+	// With an explicit budget, keep the rooms and costumes of frequently
+	// visited places resident instead of re-reading them on every visit
+	if (ConfMan.hasKey("resource_cache_size")) {
+		int cacheSize = ConfMan.getInt("resource_cache_size");
+		if (cacheSize > 0)
+			_res->setCacheMode(cacheSize * 1024);
+		else
+			warning("Ignoring invalid resource_cache_size %d", cacheSize);
+	}
+
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
 }
@@ -1419,6 +1419,12 @@ protected:
 	bool _enableEGADithering = false;
 	bool _supportsEGADithering = false;
 
+	// Dirty screen areas uploaded by updateDirtyScreen(), shown by the
+	// "strips" debugger command
+	uint32 _dirtyUploadRects = 0;
+	uint32 _dirtyUploadStrips = 0;
+	uint32 _dirtyUploadPixels = 0;
+
 	virtual void drawDirtyScreenParts();
 	void updateDirtyScreen(VirtScreenNumber slot);
 	void drawStripToScreen(VirtScreen *vs, int x, int width, int top, int bottom);
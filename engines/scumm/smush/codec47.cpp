@@ -44,17 +44,6 @@ namespace Scumm {
 		(dst)[1] = (src)[1];    \
 	} while (0)
 
-
-#else /* SCUMM_NEED_ALIGNMENT */
-
-#define COPY_4X1_LINE(dst, src)               \
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#define COPY_2X1_LINE(dst, src)               \
-	*(uint16 *)(dst) = *(const uint16 *)(src)
-
-#endif
-
 #define FILL_4X1_LINE(dst, val) \
 	do {                        \
 		(dst)[0] = val;         \
@@ -69,6 +58,24 @@ namespace Scumm {
 		(dst)[1] = val;         \
 	} while (0)
 
+#else /* SCUMM_NEED_ALIGNMENT */
+
+#define COPY_4X1_LINE(dst, src)               \
+	*(uint32 *)(dst) = *(const uint32 *)(src)
+
+#define COPY_2X1_LINE(dst, src)               \
+	*(uint16 *)(dst) = *(const uint16 *)(src)
+
+/* All bytes of the fill pattern are equal, so endianness doesn't matter */
+
+#define FILL_4X1_LINE(dst, val)               \
+	*(uint32 *)(dst) = (uint32)(val) * 0x01010101
+
+#define FILL_2X1_LINE(dst, val)               \
+	*(uint16 *)(dst) = (uint16)((val) * 0x0101)
+
+#endif /* SCUMM_NEED_ALIGNMENT */
+
 #define MOTION_OFFSET_TABLE_SIZE 0xF8
 #define PROCESS_SUBBLOCKS        0xFF
 #define FILL_SINGLE_COLOR        0xFE
@@ -21,6 +21,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 #include "common/rect.h"
@@ -229,6 +230,11 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_base = nullptr;
 	_frameBuffer = nullptr;
 	_specialBuffer = nullptr;
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
+	_zlibBuffer = nullptr;
+	_zlibBufferSize = 0;
+	_currentPrefetchedFrame = nullptr;
 
 	_seekPos = -1;
 
@@ -315,6 +321,8 @@ void SmushPlayer::release() {
 	delete _strings;
 	_strings = nullptr;
 
+	flushPrefetchedFrames();
+
 	delete _base;
 	_base = nullptr;
 
@@ -324,6 +332,14 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = nullptr;
 
+	free(_chunkBuffer);
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
+
+	free(_zlibBuffer);
+	_zlibBuffer = nullptr;
+	_zlibBufferSize = 0;
+
 	_IACTstream = nullptr;
 
 	_vm->_smushActive = false;
@@ -804,22 +820,45 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 	}
 }
 
+static byte *reserveBuffer(byte *&buffer, uint32 &bufferSize, uint32 size) {
+	if (size > bufferSize) {
+		free(buffer);
+		buffer = (byte *)malloc(size);
+		assert(buffer);
+		bufferSize = size;
+	}
+	return buffer;
+}
+
 void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b) {
 	if (_skipNext) {
 		_skipNext = false;
 		return;
 	}
 
-	int32 chunkSize = subSize;
-	byte *chunkBuffer = (byte *)malloc(chunkSize);
-	assert(chunkBuffer);
-	b.read(chunkBuffer, chunkSize);
+	byte *fobjBuffer = nullptr;
+	if (_currentPrefetchedFrame) {
+		// Use the copy inflated while the previous frame was shown
+		const int32 offset = b.pos();
+		const Common::Array<SmushPrefetchedFrame::InflatedObject> &objects = _currentPrefetchedFrame->inflatedObjects;
+		for (uint i = 0; i < objects.size(); i++) {
+			if (objects[i].offset == offset) {
+				fobjBuffer = objects[i].data;
+				break;
+			}
+		}
+	}
+
+	if (!fobjBuffer) {
+		int32 chunkSize = subSize;
+		byte *chunkBuffer = reserveBuffer(_chunkBuffer, _chunkBufferSize, chunkSize);
+		b.read(chunkBuffer, chunkSize);
 
-	unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
-	byte *fobjBuffer = (byte *)malloc(decompressedSize);
-	if (!Common::inflateZlib(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
-		error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
-	free(chunkBuffer);
+		unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
+		fobjBuffer = reserveBuffer(_zlibBuffer, _zlibBufferSize, decompressedSize);
+		if (!Common::inflateZlib(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
+			error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
+	}
 
 	byte *ptr = fobjBuffer;
 	int codec = READ_LE_UINT16(ptr); ptr += 2;
@@ -829,8 +868,6 @@ void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStrea
 	int height = READ_LE_UINT16(ptr); ptr += 2;
 
 	decodeFrameObject(codec, fobjBuffer + 14, left, top, width, height);
-
-	free(fobjBuffer);
 }
 
 void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b) {
@@ -850,13 +887,10 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
+	byte *chunk_buffer = reserveBuffer(_chunkBuffer, _chunkBufferSize, chunk_size);
 	b.read(chunk_buffer, chunk_size);
 
 	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
-
-	free(chunk_buffer);
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
@@ -1017,9 +1051,81 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+bool SmushPlayer::prefetchFrame() {
+	if (!_base || _seekPos >= 0 || _endOfFile || _prefetchedFrames.size() >= kMaxPrefetchedFrames)
+		return false;
+
+	const int32 chunkOffset = _base->pos();
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+
+	// Anything but a frame, and the end of the file, is left to
+	// parseNextFrame()
+	if (_base->pos() >= (int32)_baseSize || _base->err() || subType != MKTAG('F','R','M','E') || subSize < 0) {
+		_base->seek(chunkOffset, SEEK_SET);
+		return false;
+	}
+
+	SmushPrefetchedFrame frame;
+	frame.size = subSize;
+	frame.data = (byte *)malloc(subSize);
+	assert(frame.data);
+	if (_base->read(frame.data, subSize) != (uint32)subSize) {
+		free(frame.data);
+		_base->seek(chunkOffset, SEEK_SET);
+		return false;
+	}
+
+	// Inflate the zlib compressed frame objects, walking the sub-chunks the
+	// same way handleFrame() does
+	int32 pos = 0;
+	while (pos + 8 <= subSize) {
+		const uint32 objectType = READ_BE_UINT32(frame.data + pos);
+		const int32 objectSize = READ_BE_UINT32(frame.data + pos + 4);
+		const int32 objectOffset = pos + 8;
+		if (objectSize < 0 || objectOffset + objectSize > subSize)
+			break;
+
+		if (objectType == MKTAG('Z','F','O','B') && objectSize >= 4) {
+			SmushPrefetchedFrame::InflatedObject object;
+			object.offset = objectOffset;
+			object.size = READ_BE_UINT32(frame.data + objectOffset);
+			object.data = (byte *)malloc(object.size);
+			assert(object.data);
+
+			unsigned long decompressedSize = object.size;
+			if (Common::inflateZlib(object.data, &decompressedSize, frame.data + objectOffset + 4, objectSize - 4)) {
+				frame.inflatedObjects.push_back(object);
+			} else {
+				// Leave the error to handleZlibFrameObject()
+				free(object.data);
+			}
+		}
+
+		pos = objectOffset + objectSize + (objectSize & 1);
+	}
+
+	_prefetchedFrames.push_back(frame);
+	return true;
+}
+
+void SmushPlayer::flushPrefetchedFrames() {
+	for (uint i = 0; i < _prefetchedFrames.size(); i++) {
+		SmushPrefetchedFrame &frame = _prefetchedFrames[i];
+		for (uint j = 0; j < frame.inflatedObjects.size(); j++)
+			free(frame.inflatedObjects[j].data);
+		free(frame.data);
+	}
+
+	_prefetchedFrames.clear();
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		// The frames read ahead belong to the old position
+		flushPrefetchedFrames();
+
 		if (_seekFile.size() > 0) {
 			delete _base;
 
@@ -1062,6 +1168,30 @@ void SmushPlayer::parseNextFrame() {
 
 	assert(_base);
 
+	if (!_prefetchedFrames.empty()) {
+		SmushPrefetchedFrame frame = _prefetchedFrames.front();
+		_prefetchedFrames.remove_at(0);
+
+		debug(3, "Chunk: FRME (read ahead)");
+
+		// Everything in the frame, including IACT and Insane, is handled in
+		// order now, exactly as for a frame read from the file
+		Common::MemoryReadStream stream(frame.data, frame.size);
+		_currentPrefetchedFrame = &frame;
+		handleFrame(frame.size, stream);
+		_currentPrefetchedFrame = nullptr;
+
+		for (uint i = 0; i < frame.inflatedObjects.size(); i++)
+			free(frame.inflatedObjects[i].data);
+		free(frame.data);
+
+		if (_insanity)
+			_vm->_sound->processSound();
+
+		_vm->_imuseDigital->flushTracks();
+		return;
+	}
+
 	const uint32 subType = _base->readUint32BE();
 	const int32 subSize = _base->readUint32BE();
 	const int32 subOffset = _base->pos();
@@ -1263,6 +1393,10 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			timerCallback();
 		}
 
+		// When decoding fell behind, the next frame is already due and
+		// should be decoded right away instead of after the usual delay
+		const bool behindSchedule = elapsed >= ((_frame - _startFrame) * 1000) / _speed;
+
 		_vm->scummLoop_handleSound();
 
 		if (_warpNeeded) {
@@ -1308,7 +1442,10 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_imuseDigital->stopSMUSHAudio(); // For DIG & COMI
 			break;
 		}
-		_vm->_system->delayMillis(10);
+		// While waiting for the next frame to be due, read and inflate the
+		// following ones
+		if (!behindSchedule && !prefetchFrame())
+			_vm->_system->delayMillis(10);
 	}
 
 	release();
@@ -22,6 +22,7 @@
 #if !defined(SCUMM_SMUSH_PLAYER_H) && defined(ENABLE_SCUMM_7_8)
 #define SCUMM_SMUSH_PLAYER_H
 
+#include "common/array.h"
 #include "common/util.h"
 
 namespace Audio {
@@ -141,6 +142,37 @@ private:
 	byte *_frameBuffer;
 	byte *_specialBuffer;
 
+	// Scratch buffers for frame objects, kept for the whole video instead
+	// of being allocated for every object of every frame
+	byte *_chunkBuffer;
+	uint32 _chunkBufferSize;
+	byte *_zlibBuffer;
+	uint32 _zlibBufferSize;
+
+	/**
+	 * A frame read ahead of time, with its ZFOB frame objects already
+	 * inflated. Only reading and inflating happen ahead; all chunks are
+	 * still handled in order when the frame is due.
+	 */
+	struct SmushPrefetchedFrame {
+		byte *data;
+		int32 size;
+
+		struct InflatedObject {
+			int32 offset; ///< Offset of the ZFOB payload within data
+			byte *data;
+			uint32 size;
+		};
+		Common::Array<InflatedObject> inflatedObjects;
+	};
+
+	// The queue is kept short, so that seeks (which discard it) and the
+	// end of the video do not waste much reading
+	static const uint kMaxPrefetchedFrames = 2;
+
+	Common::Array<SmushPrefetchedFrame> _prefetchedFrames;
+	const SmushPrefetchedFrame *_currentPrefetchedFrame;
+
 	Common::String _seekFile;
 	uint32 _startFrame;
 	uint32 _startTime;
@@ -229,6 +261,8 @@ protected:
 private:
 	SmushFont *getFont(int font);
 	void parseNextFrame();
+	bool prefetchFrame();
+	void flushPrefetchedFrames();
 	void init(int32 spped);
 	void setupAnim(const char *file);
 	void updateScreen();
@@ -0,0 +1,150 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "common/util.h"
+
+#include "graphics/yuv_to_rgb.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+// The conversion below reproduces the clip tables built by YUVToRGBLookup
+// exactly: the sum of luminance and chroma is clamped to the valid range,
+// rescaled from [16, 235] to [0, 255] for ITU luminance, and then reduced
+// to the channel precision of the target format.
+
+static inline int clipChannel(int value, YUVToRGBManager::LuminanceScale scale) {
+	if (scale == YUVToRGBManager::kScaleFull)
+		return CLIP(value, 0, 255);
+
+	return (CLIP(value, 16, 235) - 16) * 255 / 219;
+}
+
+static FORCEINLINE __m128i clipChannelSSE2(__m128i value, YUVToRGBManager::LuminanceScale scale) {
+	if (scale == YUVToRGBManager::kScaleFull)
+		return _mm_max_epi16(_mm_min_epi16(value, _mm_set1_epi16(255)), _mm_setzero_si128());
+
+	value = _mm_sub_epi16(_mm_max_epi16(_mm_min_epi16(value, _mm_set1_epi16(235)), _mm_set1_epi16(16)), _mm_set1_epi16(16));
+	// (value * 255) / 219 for value in [0, 219], as a multiplication by 19153 / 2^22
+	return _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(value, _mm_set1_epi16(255)), _mm_set1_epi16(19153)), 6);
+}
+
+template<typename PixelInt>
+static void convertRowSSE2Impl(byte *dst, const Graphics::PixelFormat &format, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *aSrc, const int16 *chroma, int width) {
+	const int16 *crR  = chroma;
+	const int16 *crbG = chroma + width;
+	const int16 *cbB  = chroma + width * 2;
+	PixelInt *dstPtr = (PixelInt *)dst;
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rLoss = _mm_cvtsi32_si128(format.rLoss);
+	const __m128i gLoss = _mm_cvtsi32_si128(format.gLoss);
+	const __m128i bLoss = _mm_cvtsi32_si128(format.bLoss);
+	const __m128i aLoss = _mm_cvtsi32_si128(format.aLoss);
+	const __m128i rShift = _mm_cvtsi32_si128(format.rShift);
+	const __m128i gShift = _mm_cvtsi32_si128(format.gShift);
+	const __m128i bShift = _mm_cvtsi32_si128(format.bShift);
+	const __m128i aShift = _mm_cvtsi32_si128(format.aShift);
+	const PixelInt aMask = (0xFF >> format.aLoss) << format.aShift;
+
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		__m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(ySrc + x)), zero);
+		__m128i r = clipChannelSSE2(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)(crR + x))), scale);
+		__m128i g = clipChannelSSE2(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)(crbG + x))), scale);
+		__m128i b = clipChannelSSE2(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)(cbB + x))), scale);
+		r = _mm_srl_epi16(r, rLoss);
+		g = _mm_srl_epi16(g, gLoss);
+		b = _mm_srl_epi16(b, bLoss);
+
+		__m128i a = zero;
+		if (aSrc)
+			a = _mm_srl_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(aSrc + x)), zero), aLoss);
+
+		if (sizeof(PixelInt) == 2) {
+			__m128i pixels = _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, rShift), _mm_sll_epi16(g, gShift)), _mm_sll_epi16(b, bShift));
+			if (aSrc)
+				pixels = _mm_or_si128(pixels, _mm_sll_epi16(a, aShift));
+			else
+				pixels = _mm_or_si128(pixels, _mm_set1_epi16((int16)aMask));
+			_mm_storeu_si128((__m128i *)(dstPtr + x), pixels);
+		} else {
+			__m128i lo = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(r, zero), rShift),
+			                                       _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), gShift)),
+			                          _mm_sll_epi32(_mm_unpacklo_epi16(b, zero), bShift));
+			__m128i hi = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(r, zero), rShift),
+			                                       _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), gShift)),
+			                          _mm_sll_epi32(_mm_unpackhi_epi16(b, zero), bShift));
+			if (aSrc) {
+				lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(a, zero), aShift));
+				hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(a, zero), aShift));
+			} else {
+				lo = _mm_or_si128(lo, _mm_set1_epi32((int32)aMask));
+				hi = _mm_or_si128(hi, _mm_set1_epi32((int32)aMask));
+			}
+			_mm_storeu_si128((__m128i *)(dstPtr + x), lo);
+			_mm_storeu_si128((__m128i *)(dstPtr + x + 4), hi);
+		}
+	}
+
+	for (; x < width; x++) {
+		PixelInt pixel = ((clipChannel(ySrc[x] + crR[x], scale) >> format.rLoss) << format.rShift) |
+		                 ((clipChannel(ySrc[x] + crbG[x], scale) >> format.gLoss) << format.gShift) |
+		                 ((clipChannel(ySrc[x] + cbB[x], scale) >> format.bLoss) << format.bShift);
+		if (aSrc)
+			pixel |= (aSrc[x] >> format.aLoss) << format.aShift;
+		else
+			pixel |= aMask;
+		dstPtr[x] = pixel;
+	}
+}
+
+void YUVToRGBManager::convertRowSSE2(byte *dst, const Graphics::PixelFormat &format, LuminanceScale scale, const byte *ySrc, const byte *aSrc, const int16 *chroma, int width) {
+	if (format.bytesPerPixel == 2)
+		convertRowSSE2Impl<uint16>(dst, format, scale, ySrc, aSrc, chroma, width);
+	else
+		convertRowSSE2Impl<uint32>(dst, format, scale, ySrc, aSrc, chroma, width);
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
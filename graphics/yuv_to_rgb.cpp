@@ -82,6 +82,8 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/system.h"
+
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
@@ -100,11 +102,17 @@ public:
 	const int16 *getColorTable() const { return _colorTab; }
 	const byte *getClipTable() const { return _clipTable; }
 
+	// Chroma contributions without the clip table offsets, for convertRow()
+	int16 getRedChroma(byte v) const { return _colorTab[v] - _rBase; }
+	int16 getGreenChroma(byte u, byte v) const { return _colorTab[256 + v] + _colorTab[512 + u] - _gBase; }
+	int16 getBlueChroma(byte u) const { return _colorTab[768 + u] - _bBase; }
+
 private:
 	Graphics::PixelFormat _format;
 	YUVToRGBManager::LuminanceScale _scale;
 	int16 _colorTab[4 * 256]; // 2048 bytes
 	byte _clipTable[3 * 768];
+	int16 _rBase, _gBase, _bBase;
 };
 
 YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale) {
@@ -118,6 +126,10 @@ YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::Lu
 	uint b_offset = (format.bLoss == format.gLoss) ? g_offset :
 	                (format.bLoss == format.rLoss) ? r_offset : g_offset + 768;
 
+	_rBase = r_offset + 256;
+	_gBase = g_offset + 256;
+	_bBase = b_offset + 256;
+
 	byte *r_2_pix_alloc = &_clipTable[r_offset];
 	byte *g_2_pix_alloc = &_clipTable[g_offset];
 	byte *b_2_pix_alloc = &_clipTable[b_offset];
@@ -183,6 +195,8 @@ YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::Lu
 
 YUVToRGBManager::YUVToRGBManager() {
 	_lookup = 0;
+	_simdEnabled = false;
+	_simdChecked = false;
 }
 
 YUVToRGBManager::~YUVToRGBManager() {
@@ -198,6 +212,49 @@ const YUVToRGBLookup *YUVToRGBManager::getLookup(Graphics::PixelFormat format, Y
 	return _lookup;
 }
 
+bool YUVToRGBManager::useSIMD() {
+	if (!_simdChecked) {
+#ifdef SCUMMVM_SSE2
+		_simdEnabled = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+		_simdChecked = true;
+	}
+
+	return _simdEnabled;
+}
+
+void YUVToRGBManager::setSIMDEnabled(bool enabled) {
+#ifdef SCUMMVM_SSE2
+	_simdEnabled = enabled;
+#endif
+	_simdChecked = true;
+}
+
+int16 *YUVToRGBManager::getChromaRow(int width) {
+	if (_chromaRow.size() < (uint)width * 3)
+		_chromaRow.resize(width * 3);
+	return _chromaRow.begin();
+}
+
+void YUVToRGBManager::convertRow(byte *dst, const Graphics::PixelFormat &format, LuminanceScale scale, const byte *ySrc, const byte *aSrc, const int16 *chroma, int width) {
+#ifdef SCUMMVM_SSE2
+	convertRowSSE2(dst, format, scale, ySrc, aSrc, chroma, width);
+#endif
+}
+
+// Fill a row of chroma contributions from horizontally subsampled chroma planes
+static void fillChromaRowHalf(int16 *chroma, const YUVToRGBLookup *lookup, const byte *uSrc, const byte *vSrc, int halfWidth) {
+	int16 *crR  = chroma;
+	int16 *crbG = chroma + halfWidth * 2;
+	int16 *cbB  = chroma + halfWidth * 4;
+
+	for (int w = 0; w < halfWidth; w++) {
+		crR[2 * w]  = crR[2 * w + 1]  = lookup->getRedChroma(vSrc[w]);
+		crbG[2 * w] = crbG[2 * w + 1] = lookup->getGreenChroma(uSrc[w], vSrc[w]);
+		cbB[2 * w]  = cbB[2 * w + 1]  = lookup->getBlueChroma(uSrc[w]);
+	}
+}
+
 #define PUT_PIXEL(s, d) \
 	L = &clipTable[(s)]; \
 	*((PixelInt *)(d)) = ((L[cr_r] << r_shift) | (L[crb_g] << g_shift) | (L[cb_b] << b_shift) | a_mask)
@@ -246,6 +303,26 @@ void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+	if (useSIMD()) {
+		int16 *chroma = getChromaRow(yWidth);
+		byte *dstPtr = (byte *)dst->getPixels();
+
+		for (int h = 0; h < yHeight; h++) {
+			for (int w = 0; w < yWidth; w++) {
+				chroma[w]              = lookup->getRedChroma(vSrc[w]);
+				chroma[w + yWidth]     = lookup->getGreenChroma(uSrc[w], vSrc[w]);
+				chroma[w + 2 * yWidth] = lookup->getBlueChroma(uSrc[w]);
+			}
+
+			convertRow(dstPtr, dst->format, scale, ySrc, nullptr, chroma, yWidth);
+			dstPtr += dst->pitch;
+			ySrc += yPitch;
+			uSrc += uvPitch;
+			vSrc += uvPitch;
+		}
+		return;
+	}
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV444ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
@@ -303,6 +380,22 @@ void YUVToRGBManager::convert422(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+	if (useSIMD()) {
+		int16 *chroma = getChromaRow(yWidth);
+		byte *dstPtr = (byte *)dst->getPixels();
+		int halfWidth = yWidth >> 1;
+
+		for (int h = 0; h < yHeight; h++) {
+			fillChromaRowHalf(chroma, lookup, uSrc, vSrc, halfWidth);
+			convertRow(dstPtr, dst->format, scale, ySrc, nullptr, chroma, yWidth);
+			dstPtr += dst->pitch;
+			ySrc += yPitch;
+			uSrc += uvPitch;
+			vSrc += uvPitch;
+		}
+		return;
+	}
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV422ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
@@ -364,6 +457,23 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+	if (useSIMD()) {
+		int16 *chroma = getChromaRow(yWidth);
+		byte *dstPtr = (byte *)dst->getPixels();
+		int halfWidth = yWidth >> 1;
+
+		for (int h = 0; h < yHeight; h += 2) {
+			fillChromaRowHalf(chroma, lookup, uSrc, vSrc, halfWidth);
+			convertRow(dstPtr, dst->format, scale, ySrc, nullptr, chroma, yWidth);
+			convertRow(dstPtr + dst->pitch, dst->format, scale, ySrc + yPitch, nullptr, chroma, yWidth);
+			dstPtr += dst->pitch * 2;
+			ySrc += yPitch * 2;
+			uSrc += uvPitch;
+			vSrc += uvPitch;
+		}
+		return;
+	}
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV420ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
@@ -433,6 +543,24 @@ void YUVToRGBManager::convert420Alpha(Graphics::Surface *dst, YUVToRGBManager::L
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+	if (useSIMD()) {
+		int16 *chroma = getChromaRow(yWidth);
+		byte *dstPtr = (byte *)dst->getPixels();
+		int halfWidth = yWidth >> 1;
+
+		for (int h = 0; h < yHeight; h += 2) {
+			fillChromaRowHalf(chroma, lookup, uSrc, vSrc, halfWidth);
+			convertRow(dstPtr, dst->format, scale, ySrc, aSrc, chroma, yWidth);
+			convertRow(dstPtr + dst->pitch, dst->format, scale, ySrc + yPitch, aSrc + yPitch, chroma, yWidth);
+			dstPtr += dst->pitch * 2;
+			ySrc += yPitch * 2;
+			aSrc += yPitch * 2;
+			uSrc += uvPitch;
+			vSrc += uvPitch;
+		}
+		return;
+	}
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUVA420ToRGBA<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, aSrc, yWidth, yHeight, yPitch, uvPitch);
@@ -523,6 +651,38 @@ void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+	if (useSIMD()) {
+		int16 *chroma = getChromaRow(yWidth);
+		byte *dstPtr = (byte *)dst->getPixels();
+		int quarterWidth = yWidth >> 2;
+
+		for (int y = 0; y < yHeight; y++) {
+			// Same bilinear interpolation of the chroma values as in convertYUV410ToRGB()
+			int yDiff = y & 3;
+			int index = (y >> 2) * uvPitch;
+
+			for (int x = 0; x < quarterWidth; x++, index++) {
+				int uA = uSrc[index], uB = uSrc[index + 1], uC = uSrc[index + uvPitch], uD = uSrc[index + uvPitch + 1];
+				int vA = vSrc[index], vB = vSrc[index + 1], vC = vSrc[index + uvPitch], vD = vSrc[index + uvPitch + 1];
+
+				for (int xDiff = 0; xDiff < 4; xDiff++) {
+					byte u = (uA * (4 - xDiff) * (4 - yDiff) + uB * xDiff * (4 - yDiff) + uC * yDiff * (4 - xDiff) + uD * xDiff * yDiff) >> 4;
+					byte v = (vA * (4 - xDiff) * (4 - yDiff) + vB * xDiff * (4 - yDiff) + vC * yDiff * (4 - xDiff) + vD * xDiff * yDiff) >> 4;
+					int w = x * 4 + xDiff;
+
+					chroma[w]              = lookup->getRedChroma(v);
+					chroma[w + yWidth]     = lookup->getGreenChroma(u, v);
+					chroma[w + 2 * yWidth] = lookup->getBlueChroma(u);
+				}
+			}
+
+			convertRow(dstPtr, dst->format, scale, ySrc, nullptr, chroma, yWidth);
+			dstPtr += dst->pitch;
+			ySrc += yPitch;
+		}
+		return;
+	}
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV410ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
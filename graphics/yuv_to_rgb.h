@@ -38,6 +38,7 @@
 #define GRAPHICS_YUV_TO_RGB_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/singleton.h"
 #include "graphics/surface.h"
 
@@ -135,6 +136,18 @@ public:
 	 */
 	void convert410(Graphics::Surface *dst, LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
 
+	/**
+	 * Enable or disable the SIMD conversion routines. They are enabled by
+	 * default when the CPU supports them; disabling them forces the lookup
+	 * table implementation, which serves as the reference.
+	 *
+	 * Has no effect if no SIMD routines were compiled in.
+	 */
+	void setSIMDEnabled(bool enabled);
+
+	/** Return whether the SIMD conversion routines are used. */
+	bool isSIMDEnabled() { return useSIMD(); }
+
 private:
 	friend class Common::Singleton<SingletonBaseType>;
 	YUVToRGBManager();
@@ -142,7 +155,30 @@ private:
 
 	const YUVToRGBLookup *getLookup(Graphics::PixelFormat format, LuminanceScale scale);
 
+	/** Whether to use the SIMD routines, checking the CPU features on first use. */
+	bool useSIMD();
+
+	/**
+	 * Return scratch space for the chroma contributions of one row of
+	 * width pixels: three consecutive arrays of width entries holding
+	 * the red, green and blue offsets to add to the luminance.
+	 */
+	int16 *getChromaRow(int width);
+
+	/**
+	 * Convert one row of pixels, given the luminance (and optionally alpha)
+	 * values and the chroma contributions laid out as in getChromaRow().
+	 */
+	void convertRow(byte *dst, const Graphics::PixelFormat &format, LuminanceScale scale, const byte *ySrc, const byte *aSrc, const int16 *chroma, int width);
+
+#ifdef SCUMMVM_SSE2
+	static void convertRowSSE2(byte *dst, const Graphics::PixelFormat &format, LuminanceScale scale, const byte *ySrc, const byte *aSrc, const int16 *chroma, int width);
+#endif
+
 	YUVToRGBLookup *_lookup;
+	bool _simdEnabled;
+	bool _simdChecked;
+	Common::Array<int16> _chromaRow;
 };
  /** @} */
 } // End of namespace Graphics
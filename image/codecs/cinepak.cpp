@@ -58,15 +58,17 @@ inline uint16 createDitherTableIndex(const byte *clipTable, byte y, int8 u, int8
 
 /**
  * The default codebook converter for 24bpp: RGB output.
+ *
+ * The codebook entries are converted to the output format when they are
+ * loaded (see CinepakDecoder::convertCodebook()), so this only copies them.
  */
 struct CodebookConverterRGB {
 	template<typename PixelInt>
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		const int8 u = codebook.u, v = codebook.v;
+		const uint32 *color = strip.v1_color + codebookIndex * 4;
 
-		const PixelInt rgb0 = convertYUVToColor(clipTable, format, codebook.y[0], u, v);
-		const PixelInt rgb1 = convertYUVToColor(clipTable, format, codebook.y[1], u, v);
+		const PixelInt rgb0 = color[0];
+		const PixelInt rgb1 = color[1];
 
 		dst[0] = dst[1] = rgb0;
 		dst[2] = dst[3] = rgb1;
@@ -76,8 +78,8 @@ struct CodebookConverterRGB {
 		dst[2] = dst[3] = rgb1;
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const PixelInt rgb2 = convertYUVToColor(clipTable, format, codebook.y[2], u, v);
-		const PixelInt rgb3 = convertYUVToColor(clipTable, format, codebook.y[3], u, v);
+		const PixelInt rgb2 = color[2];
+		const PixelInt rgb3 = color[3];
 
 		dst[0] = dst[1] = rgb2;
 		dst[2] = dst[3] = rgb3;
@@ -90,34 +92,34 @@ struct CodebookConverterRGB {
 
 	template<typename PixelInt>
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook1 = strip.v4_codebook[codebookIndex[0]];
-		const CinepakCodebook &codebook2 = strip.v4_codebook[codebookIndex[1]];
+		const uint32 *color1 = strip.v4_color + codebookIndex[0] * 4;
+		const uint32 *color2 = strip.v4_color + codebookIndex[1] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[0], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[1], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[0], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[1], codebook2.u, codebook2.v);
+		dst[0] = color1[0];
+		dst[1] = color1[1];
+		dst[2] = color2[0];
+		dst[3] = color2[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[2], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[3], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[2], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[3], codebook2.u, codebook2.v);
+		dst[0] = color1[2];
+		dst[1] = color1[3];
+		dst[2] = color2[2];
+		dst[3] = color2[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const CinepakCodebook &codebook3 = strip.v4_codebook[codebookIndex[2]];
-		const CinepakCodebook &codebook4 = strip.v4_codebook[codebookIndex[3]];
+		const uint32 *color3 = strip.v4_color + codebookIndex[2] * 4;
+		const uint32 *color4 = strip.v4_color + codebookIndex[3] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[0], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[1], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[0], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[1], codebook4.u, codebook4.v);
+		dst[0] = color3[0];
+		dst[1] = color3[1];
+		dst[2] = color4[0];
+		dst[3] = color4[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[2], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[3], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[2], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[3], codebook4.u, codebook4.v);
+		dst[0] = color3[2];
+		dst[1] = color3[3];
+		dst[2] = color4[2];
+		dst[3] = color4[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 	}
 };
@@ -333,6 +335,13 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 	_curFrame.height = stream.readUint16BE();
 	_curFrame.stripCount = stream.readUint16BE();
 
+	// The surface is needed before the codebooks are set up, since they
+	// are converted to its pixel format
+	if (!_curFrame.surface) {
+		_curFrame.surface = new Graphics::Surface();
+		_curFrame.surface->create(_curFrame.width, _curFrame.height, _pixelFormat);
+	}
+
 	if (!_curFrame.strips) {
 		_curFrame.strips = new CinepakStrip[_curFrame.stripCount];
 		for (uint16 i = 0; i < _curFrame.stripCount; i++) {
@@ -352,11 +361,6 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 			stream.seek(-2, SEEK_CUR);
 	}
 
-	if (!_curFrame.surface) {
-		_curFrame.surface = new Graphics::Surface();
-		_curFrame.surface->create(_curFrame.width, _curFrame.height, _pixelFormat);
-	}
-
 	_y = 0;
 
 	for (uint16 i = 0; i < _curFrame.stripCount; i++) {
@@ -370,6 +374,10 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 			// Copy the dither tables
 			memcpy(_curFrame.strips[i].v1_dither, _curFrame.strips[i - 1].v1_dither, 256 * 4 * 4 * sizeof(uint32));
 			memcpy(_curFrame.strips[i].v4_dither, _curFrame.strips[i - 1].v4_dither, 256 * 4 * 4 * sizeof(uint32));
+
+			// Copy the converted codebooks
+			memcpy(_curFrame.strips[i].v1_color, _curFrame.strips[i - 1].v1_color, 256 * 4 * sizeof(uint32));
+			memcpy(_curFrame.strips[i].v4_color, _curFrame.strips[i - 1].v4_color, 256 * 4 * sizeof(uint32));
 		}
 
 		_curFrame.strips[i].id = stream.readUint16BE();
@@ -446,6 +454,8 @@ void CinepakDecoder::initializeCodebook(uint16 strip, byte codebookType) {
 			ditherCodebookQT(strip, codebookType, i);
 		else if (_ditherType == kDitherTypeVFW)
 			ditherCodebookVFW(strip, codebookType, i);
+		else
+			convertCodebook(strip, codebookType, i);
 	}
 }
 
@@ -482,11 +492,14 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Dither the codebook if we're dithering, or convert it to
+			// the output format otherwise
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
 			else if (_ditherType == kDitherTypeVFW)
 				ditherCodebookVFW(strip, codebookType, i);
+			else
+				convertCodebook(strip, codebookType, i);
 		}
 	}
 }
@@ -549,6 +562,18 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 	}
 }
 
+void CinepakDecoder::convertCodebook(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	const Graphics::PixelFormat &format = _curFrame.surface->format;
+	if (format.bytesPerPixel == 1)
+		return;
+
+	const CinepakCodebook &codebook = (codebookType == 1) ? _curFrame.strips[strip].v1_codebook[codebookIndex] : _curFrame.strips[strip].v4_codebook[codebookIndex];
+	uint32 *output = ((codebookType == 1) ? _curFrame.strips[strip].v1_color : _curFrame.strips[strip].v4_color) + codebookIndex * 4;
+
+	for (int i = 0; i < 4; i++)
+		output[i] = convertYUVToColor(_clipTable, format, codebook.y[i], codebook.u, codebook.v);
+}
+
 static inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
 	return colorMap[CLIP<int>(index, 0, 1023)];
 }
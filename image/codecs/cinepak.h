@@ -46,6 +46,7 @@ struct CinepakStrip {
 	Common::Rect rect;
 	CinepakCodebook v1_codebook[256], v4_codebook[256];
 	uint32 v1_dither[256 * 4 * 4], v4_dither[256 * 4 * 4];
+	uint32 v1_color[256 * 4], v4_color[256 * 4]; // codebook entries in the output pixel format
 };
 
 struct CinepakFrame {
@@ -103,6 +104,7 @@ private:
 	void ditherVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 	void ditherCodebookQT(uint16 strip, byte codebookType, uint16 codebookIndex);
 	void ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex);
+	void convertCodebook(uint16 strip, byte codebookType, uint16 codebookIndex);
 };
 
 } // End of namespace Image
@@ -468,6 +468,11 @@ IndeoDecoderBase::IndeoDecoderBase(uint16 width, uint16 height, uint bitsPerPixe
 	_height = height;
 	_bitsPerPixel = bitsPerPixel;
 	_pixelFormat = g_system->getScreenFormat();
+#ifdef SCUMMVM_SSE2
+	_useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#else
+	_useSSE2 = false;
+#endif
 
 	// Default to a 32bpp format, if in 8bpp mode
 	if (_pixelFormat.bytesPerPixel == 1)
@@ -731,6 +736,19 @@ void IndeoDecoderBase::recomposeHaar(const IVIPlaneDesc *_plane,
 	const short *b3Ptr = _plane->_bands[3]._buf;
 
 	for (int y = 0; y < _plane->_height; y += 2) {
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			IndeoDSP::ffIviRecomposeHaarRowSSE2(b0Ptr, b1Ptr, b2Ptr, b3Ptr, dst, dstPitch, _plane->_width);
+
+			dst += dstPitch << 1;
+			b0Ptr += pitch;
+			b1Ptr += pitch;
+			b2Ptr += pitch;
+			b3Ptr += pitch;
+			continue;
+		}
+#endif
+
 		for (int x = 0, indx = 0; x < _plane->_width; x += 2, indx++) {
 			// load coefficients
 			int b0 = b0Ptr[indx]; //should be: b0 = (_numBands > 0) ? b0Ptr[indx] : 0;
@@ -783,6 +801,21 @@ void IndeoDecoderBase::recompose53(const IVIPlaneDesc *_plane,
 
 		if (y + 2 >= _plane->_height)
 			pitch_ = 0;
+
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			IndeoDSP::ffIviRecompose53RowSSE2(b0Ptr, b1Ptr, b2Ptr, b3Ptr, back_pitch, pitch_, dst, dstPitch, _plane->_width);
+
+			dst += dstPitch << 1;
+			back_pitch = -pitch_;
+			b0Ptr += pitch_;
+			b1Ptr += pitch_;
+			b2Ptr += pitch_;
+			b3Ptr += pitch_;
+			continue;
+		}
+#endif
+
 		// load storage variables with values
 		if (numBands > 0) {
 			b0_1 = b0Ptr[0];
@@ -921,6 +954,14 @@ void IndeoDecoderBase::outputPlane(IVIPlaneDesc *_plane, uint8 *dst, int dstPitc
 		return;
 
 	for (int y = 0; y < _plane->_height; y++) {
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			IndeoDSP::ffIviOutputRowSSE2(src, dst, _plane->_width);
+			src += pitch;
+			dst += dstPitch;
+			continue;
+		}
+#endif
 		for (int x = 0; x < _plane->_width; x++)
 			dst[x] = avClipUint8(src[x] + 128);
 		src += pitch;
@@ -1002,6 +1043,12 @@ int IndeoDecoderBase::processEmptyTile(IVIBandDesc *band,
 		int numBlocks = (band->_mbSize != band->_blkSize) ? 4 : 1; // number of blocks per mb
 		IviMCFunc mcNoDeltaFunc = (band->_blkSize == 8) ? IndeoDSP::ffIviMc8x8NoDelta
 			: IndeoDSP::ffIviMc4x4NoDelta;
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			mcNoDeltaFunc = (band->_blkSize == 8) ? IndeoDSP::ffIviMc8x8NoDeltaSSE2
+				: IndeoDSP::ffIviMc4x4NoDeltaSSE2;
+		}
+#endif
 
 		int mbn;
 		for (mbn = 0, mb = tile->_mbs; mbn < tile->_numMBs; mb++, mbn++) {
@@ -1072,11 +1119,27 @@ int IndeoDecoderBase::decodeBlocks(GetBits *_gb, IVIBandDesc *band, IVITile *til
 		mcNoDeltaFunc       = IndeoDSP::ffIviMc8x8NoDelta;
 		mcAvgWithDeltaFunc = IndeoDSP::ffIviMcAvg8x8Delta;
 		mcAvgNoDeltaFunc   = IndeoDSP::ffIviMcAvg8x8NoDelta;
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			mcWithDeltaFunc    = IndeoDSP::ffIviMc8x8DeltaSSE2;
+			mcNoDeltaFunc      = IndeoDSP::ffIviMc8x8NoDeltaSSE2;
+			mcAvgWithDeltaFunc = IndeoDSP::ffIviMcAvg8x8DeltaSSE2;
+			mcAvgNoDeltaFunc   = IndeoDSP::ffIviMcAvg8x8NoDeltaSSE2;
+		}
+#endif
 	} else {
 		mcWithDeltaFunc     = IndeoDSP::ffIviMc4x4Delta;
 		mcNoDeltaFunc       = IndeoDSP::ffIviMc4x4NoDelta;
 		mcAvgWithDeltaFunc = IndeoDSP::ffIviMcAvg4x4Delta;
 		mcAvgNoDeltaFunc   = IndeoDSP::ffIviMcAvg4x4NoDelta;
+#ifdef SCUMMVM_SSE2
+		if (_useSSE2) {
+			mcWithDeltaFunc    = IndeoDSP::ffIviMc4x4DeltaSSE2;
+			mcNoDeltaFunc      = IndeoDSP::ffIviMc4x4NoDeltaSSE2;
+			mcAvgWithDeltaFunc = IndeoDSP::ffIviMcAvg4x4DeltaSSE2;
+			mcAvgNoDeltaFunc   = IndeoDSP::ffIviMcAvg4x4NoDeltaSSE2;
+		}
+#endif
 	}
 
 	int mbn;
@@ -442,6 +442,7 @@ private:
 	 */
 	int decode_band(IVIBandDesc *band);
 
+protected:
 	/**
 	 *  Haar wavelet recomposition filter for Indeo 4
 	 *
@@ -460,6 +461,7 @@ private:
 	 */
 	void recompose53(const IVIPlaneDesc *plane, uint8 *dst, const int dstPitch);
 
+private:
 	/*
 	 *  Convert and output the current plane.
 	 *  This conversion is done by adding back the bias value of 128
@@ -523,6 +525,7 @@ protected:
 	uint _bitsPerPixel;
 	Graphics::PixelFormat _pixelFormat;
 	Graphics::Surface *_surface;
+	bool _useSSE2;
 
 	/**
 	 *  Scan patterns shared between indeo4 and indeo5
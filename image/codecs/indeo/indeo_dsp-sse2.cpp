@@ -0,0 +1,381 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "image/codecs/indeo/indeo_dsp.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Image {
+namespace Indeo {
+
+// Each row of an 8x8 block is eight int16 values, i.e. exactly one register;
+// a row of a 4x4 block fills the lower half of one. All the routines below
+// produce the same results as the scalar templates in indeo_dsp.cpp,
+// including the int16 wrap-around of the stores.
+
+static FORCEINLINE __m128i loadRow(const int16 *src) {
+	return _mm_loadu_si128((const __m128i *)src);
+}
+
+static FORCEINLINE void storeRow(int16 *dst, __m128i row) {
+	_mm_storeu_si128((__m128i *)dst, row);
+}
+
+template<int size>
+static FORCEINLINE __m128i loadBlockRow(const int16 *src) {
+	return (size == 8) ? loadRow(src) : _mm_loadl_epi64((const __m128i *)src);
+}
+
+template<int size>
+static FORCEINLINE void storeBlockRow(int16 *dst, __m128i row) {
+	if (size == 8)
+		storeRow(dst, row);
+	else
+		_mm_storel_epi64((__m128i *)dst, row);
+}
+
+// (a + b) >> 1 without leaving 16 bits
+static FORCEINLINE __m128i halfSum(__m128i a, __m128i b) {
+	__m128i odd = _mm_and_si128(_mm_and_si128(a, b), _mm_set1_epi16(1));
+	return _mm_add_epi16(_mm_add_epi16(_mm_srai_epi16(a, 1), _mm_srai_epi16(b, 1)), odd);
+}
+
+// (a + b + c + d) >> 2, computed on 32 bits since the sum may overflow 16 bits
+static FORCEINLINE __m128i quarterSum(__m128i a, __m128i b, __m128i c, __m128i d) {
+	__m128i lo = _mm_add_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16), _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16)),
+	                           _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(c, c), 16), _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16)));
+	__m128i hi = _mm_add_epi32(_mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16), _mm_srai_epi32(_mm_unpackhi_epi16(b, b), 16)),
+	                           _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(c, c), 16), _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16)));
+	return _mm_packs_epi32(_mm_srai_epi32(lo, 2), _mm_srai_epi32(hi, 2));
+}
+
+template<int size>
+static FORCEINLINE __m128i interpolateRow(const int16 *refBuf, uint32 pitch, int mcType) {
+	switch (mcType) {
+	case 1: // horizontal halfpel interpolation
+		return halfSum(loadBlockRow<size>(refBuf), loadBlockRow<size>(refBuf + 1));
+	case 2: // vertical halfpel interpolation
+		return halfSum(loadBlockRow<size>(refBuf), loadBlockRow<size>(refBuf + pitch));
+	case 3: // vertical and horizontal halfpel interpolation
+		return quarterSum(loadBlockRow<size>(refBuf), loadBlockRow<size>(refBuf + 1),
+		                  loadBlockRow<size>(refBuf + pitch), loadBlockRow<size>(refBuf + pitch + 1));
+	default: // fullpel (no interpolation)
+		return loadBlockRow<size>(refBuf);
+	}
+}
+
+template<int size, bool addDelta>
+static void mcSSE2(int16 *buf, uint32 dpitch, const int16 *refBuf, uint32 pitch, int mcType) {
+	if (mcType < 0 || mcType > 3)
+		return;
+
+	for (int i = 0; i < size; i++, buf += dpitch, refBuf += pitch) {
+		__m128i row = interpolateRow<size>(refBuf, pitch, mcType);
+		if (addDelta)
+			row = _mm_add_epi16(loadBlockRow<size>(buf), row);
+		storeBlockRow<size>(buf, row);
+	}
+}
+
+template<int size, bool addDelta>
+static void mcAvgSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2) {
+	int16 tmp[size * size];
+
+	mcSSE2<size, false>(tmp, size, refBuf, pitch, mcType);
+	mcSSE2<size, true>(tmp, size, refBuf2, pitch, mcType2);
+	for (int i = 0; i < size; i++, buf += pitch) {
+		__m128i row = _mm_srai_epi16(loadBlockRow<size>(tmp + i * size), 1);
+		if (addDelta)
+			row = _mm_add_epi16(loadBlockRow<size>(buf), row);
+		storeBlockRow<size>(buf, row);
+	}
+}
+
+void IndeoDSP::ffIviMc8x8DeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType) {
+	mcSSE2<8, true>(buf, pitch, refBuf, pitch, mcType);
+}
+
+void IndeoDSP::ffIviMc8x8NoDeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType) {
+	mcSSE2<8, false>(buf, pitch, refBuf, pitch, mcType);
+}
+
+void IndeoDSP::ffIviMcAvg8x8DeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2) {
+	mcAvgSSE2<8, true>(buf, refBuf, refBuf2, pitch, mcType, mcType2);
+}
+
+void IndeoDSP::ffIviMcAvg8x8NoDeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2) {
+	mcAvgSSE2<8, false>(buf, refBuf, refBuf2, pitch, mcType, mcType2);
+}
+
+void IndeoDSP::ffIviMc4x4DeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType) {
+	mcSSE2<4, true>(buf, pitch, refBuf, pitch, mcType);
+}
+
+void IndeoDSP::ffIviMc4x4NoDeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType) {
+	mcSSE2<4, false>(buf, pitch, refBuf, pitch, mcType);
+}
+
+void IndeoDSP::ffIviMcAvg4x4DeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2) {
+	mcAvgSSE2<4, true>(buf, refBuf, refBuf2, pitch, mcType, mcType2);
+}
+
+void IndeoDSP::ffIviMcAvg4x4NoDeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2) {
+	mcAvgSSE2<4, false>(buf, refBuf, refBuf2, pitch, mcType, mcType2);
+}
+
+// Returns ((sum + 2) >> 2) + 128, with the bias folded into the rounding
+static FORCEINLINE __m128i haarPixel(__m128i sum) {
+	return _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(2 + (128 << 2))), 2);
+}
+
+static FORCEINLINE __m128i widen(__m128i v, bool high) {
+	v = high ? _mm_unpackhi_epi16(v, v) : _mm_unpacklo_epi16(v, v);
+	return _mm_srai_epi32(v, 16);
+}
+
+void IndeoDSP::ffIviRecomposeHaarRowSSE2(const int16 *b0Ptr, const int16 *b1Ptr, const int16 *b2Ptr, const int16 *b3Ptr,
+		uint8 *dst, int dstPitch, int width) {
+	int x = 0, indx = 0;
+	for (; x + 16 <= width; x += 16, indx += 8) {
+		__m128i b0 = loadRow(b0Ptr + indx);
+		__m128i b1 = loadRow(b1Ptr + indx);
+		__m128i b2 = loadRow(b2Ptr + indx);
+		__m128i b3 = loadRow(b3Ptr + indx);
+		__m128i p[4][2];
+
+		for (int h = 0; h < 2; h++) {
+			__m128i w0 = widen(b0, h != 0);
+			__m128i w1 = widen(b1, h != 0);
+			__m128i w2 = widen(b2, h != 0);
+			__m128i w3 = widen(b3, h != 0);
+			__m128i s01 = _mm_add_epi32(w0, w1);
+			__m128i d01 = _mm_sub_epi32(w0, w1);
+			__m128i s23 = _mm_add_epi32(w2, w3);
+			__m128i d23 = _mm_sub_epi32(w2, w3);
+
+			p[0][h] = haarPixel(_mm_add_epi32(s01, s23));
+			p[1][h] = haarPixel(_mm_sub_epi32(s01, s23));
+			p[2][h] = haarPixel(_mm_add_epi32(d01, d23));
+			p[3][h] = haarPixel(_mm_sub_epi32(d01, d23));
+		}
+
+		// Saturating packs clip to [0, 255] exactly like avClipUint8()
+		__m128i p0 = _mm_packs_epi32(p[0][0], p[0][1]);
+		__m128i p1 = _mm_packs_epi32(p[1][0], p[1][1]);
+		__m128i p2 = _mm_packs_epi32(p[2][0], p[2][1]);
+		__m128i p3 = _mm_packs_epi32(p[3][0], p[3][1]);
+		__m128i top = _mm_packus_epi16(_mm_unpacklo_epi16(p0, p1), _mm_unpackhi_epi16(p0, p1));
+		__m128i bottom = _mm_packus_epi16(_mm_unpacklo_epi16(p2, p3), _mm_unpackhi_epi16(p2, p3));
+		_mm_storeu_si128((__m128i *)(dst + x), top);
+		_mm_storeu_si128((__m128i *)(dst + dstPitch + x), bottom);
+	}
+
+	for (; x < width; x += 2, indx++) {
+		int b0 = b0Ptr[indx];
+		int b1 = b1Ptr[indx];
+		int b2 = b2Ptr[indx];
+		int b3 = b3Ptr[indx];
+
+		dst[x] = avClipUint8(((b0 + b1 + b2 + b3 + 2) >> 2) + 128);
+		dst[x + 1] = avClipUint8(((b0 + b1 - b2 - b3 + 2) >> 2) + 128);
+		dst[dstPitch + x] = avClipUint8(((b0 - b1 + b2 - b3 + 2) >> 2) + 128);
+		dst[dstPitch + x + 1] = avClipUint8(((b0 - b1 - b2 + b3 + 2) >> 2) + 128);
+	}
+}
+
+// Four consecutive coefficients, sign extended to 32 bits
+static FORCEINLINE __m128i loadWide(const int16 *src) {
+	__m128i v = _mm_loadl_epi64((const __m128i *)src);
+	return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+}
+
+static FORCEINLINE __m128i mul6(__m128i v) {
+	return _mm_add_epi32(_mm_slli_epi32(v, 2), _mm_slli_epi32(v, 1));
+}
+
+// Vertical high-pass filter of the rows above, at and below
+static FORCEINLINE __m128i vertHPF(const int16 *ptr, int backPitch, int pitch) {
+	return _mm_add_epi32(_mm_sub_epi32(loadWide(ptr + backPitch), mul6(loadWide(ptr))), loadWide(ptr + pitch));
+}
+
+// Stores (p >> 6) + 128 of two interleaved pixel columns, clipped to [0, 255]
+static FORCEINLINE void store53Pixels(uint8 *dst, __m128i even, __m128i odd) {
+	const __m128i bias = _mm_set1_epi32(128);
+	even = _mm_add_epi32(_mm_srai_epi32(even, 6), bias);
+	odd = _mm_add_epi32(_mm_srai_epi32(odd, 6), bias);
+	__m128i words = _mm_packs_epi32(_mm_unpacklo_epi32(even, odd), _mm_unpackhi_epi32(even, odd));
+	_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(words, words));
+}
+
+// One pair of output pixels of each line, with the neighbours of column indx
+// clamped to the band edges like the scalar code in recompose53() does
+static void recompose53Pixels(const int16 *b0Ptr, const int16 *b1Ptr, const int16 *b2Ptr, const int16 *b3Ptr,
+		int backPitch, int pitch, uint8 *dst, int dstPitch, int indx, int last) {
+	int l = MAX(indx - 1, 0);
+	int r = MIN(indx + 1, last);
+	int x = indx * 2;
+
+	int b0 = b0Ptr[indx];
+	int b0R = b0Ptr[r];
+	int b0D = b0Ptr[pitch + indx];
+	int p0 = b0 << 4;
+	int p1 = (b0 + b0R) << 3;
+	int p2 = (b0 + b0D) << 3;
+	int p3 = (b0 + b0R + b0D + b0Ptr[pitch + r]) << 2;
+
+	int b1 = b1Ptr[indx];
+	int b1U = b1Ptr[backPitch + indx];
+	int b1V = b1U - b1 * 6 + b1Ptr[pitch + indx];
+	int b1VR = b1Ptr[backPitch + r] - b1Ptr[r] * 6 + b1Ptr[pitch + r];
+	int tmp2 = b1U - b1 * 6 + b1V;
+	p0 += (b1 + b1U) << 3;
+	p1 += (b1 + b1U + b1Ptr[backPitch + r] + b1Ptr[r]) << 2;
+	p2 += tmp2 << 2;
+	p3 += (tmp2 + b1VR) << 1;
+
+	int tmp0 = b2Ptr[l] + b2Ptr[indx];
+	int tmp1 = b2Ptr[l] - b2Ptr[indx] * 6 + b2Ptr[r];
+	p0 += tmp0 << 3;
+	p1 += tmp1 << 2;
+	p2 += (tmp0 + b2Ptr[pitch + l] + b2Ptr[pitch + indx]) << 2;
+	p3 += (tmp1 + b2Ptr[pitch + l] - b2Ptr[pitch + indx] * 6 + b2Ptr[pitch + r]) << 1;
+
+	int b3L = b3Ptr[backPitch + l] + b3Ptr[l];
+	int b3C = b3Ptr[backPitch + indx] + b3Ptr[indx];
+	int b3R = b3Ptr[backPitch + r] + b3Ptr[r];
+	int w3L = b3Ptr[backPitch + l] - b3Ptr[l] * 6 + b3Ptr[pitch + l];
+	int w3C = b3Ptr[backPitch + indx] - b3Ptr[indx] * 6 + b3Ptr[pitch + indx];
+	int w3R = b3Ptr[backPitch + r] - b3Ptr[r] * 6 + b3Ptr[pitch + r];
+	p0 += (b3L + b3C) << 2;
+	p1 += (b3L - b3C * 6 + b3R) << 1;
+	p2 += (w3L + w3C) << 1;
+	p3 += w3L - w3C * 6 + w3R;
+
+	dst[x] = avClipUint8((p0 >> 6) + 128);
+	dst[x + 1] = avClipUint8((p1 >> 6) + 128);
+	dst[dstPitch + x] = avClipUint8((p2 >> 6) + 128);
+	dst[dstPitch + x + 1] = avClipUint8((p3 >> 6) + 128);
+}
+
+void IndeoDSP::ffIviRecompose53RowSSE2(const int16 *b0Ptr, const int16 *b1Ptr, const int16 *b2Ptr, const int16 *b3Ptr,
+		int backPitch, int pitch, uint8 *dst, int dstPitch, int width) {
+	// Index of the last coefficient column, neighbours past it are clamped
+	const int last = (width + 1) / 2 - 1;
+
+	recompose53Pixels(b0Ptr, b1Ptr, b2Ptr, b3Ptr, backPitch, pitch, dst, dstPitch, 0, last);
+
+	// Four coefficient columns, i.e. eight pixels of each line, at a time;
+	// the columns on both sides of them are always inside the band here
+	int indx = 1;
+	for (; indx + 4 <= last; indx += 4) {
+		const int16 *b0 = b0Ptr + indx;
+		const int16 *b1 = b1Ptr + indx;
+		const int16 *b2 = b2Ptr + indx;
+		const int16 *b3 = b3Ptr + indx;
+
+		// LL-band: LPF both vertically and horizontally
+		__m128i c = loadWide(b0);
+		__m128i r = loadWide(b0 + 1);
+		__m128i d = loadWide(b0 + pitch);
+		__m128i p0 = _mm_slli_epi32(c, 4);
+		__m128i p1 = _mm_slli_epi32(_mm_add_epi32(c, r), 3);
+		__m128i p2 = _mm_slli_epi32(_mm_add_epi32(c, d), 3);
+		__m128i p3 = _mm_slli_epi32(_mm_add_epi32(_mm_add_epi32(c, r), _mm_add_epi32(d, loadWide(b0 + pitch + 1))), 2);
+
+		// HL-band: HPF vertically and LPF horizontally
+		c = loadWide(b1);
+		__m128i u = loadWide(b1 + backPitch);
+		__m128i tmp2 = _mm_add_epi32(_mm_sub_epi32(u, mul6(c)), vertHPF(b1, backPitch, pitch));
+		p0 = _mm_add_epi32(p0, _mm_slli_epi32(_mm_add_epi32(c, u), 3));
+		p1 = _mm_add_epi32(p1, _mm_slli_epi32(_mm_add_epi32(_mm_add_epi32(c, u), _mm_add_epi32(loadWide(b1 + backPitch + 1), loadWide(b1 + 1))), 2));
+		p2 = _mm_add_epi32(p2, _mm_slli_epi32(tmp2, 2));
+		p3 = _mm_add_epi32(p3, _mm_slli_epi32(_mm_add_epi32(tmp2, vertHPF(b1 + 1, backPitch, pitch)), 1));
+
+		// LH-band: LPF vertically and HPF horizontally
+		__m128i l = loadWide(b2 - 1);
+		c = loadWide(b2);
+		__m128i tmp0 = _mm_add_epi32(l, c);
+		__m128i tmp1 = _mm_add_epi32(_mm_sub_epi32(l, mul6(c)), loadWide(b2 + 1));
+		__m128i dl = loadWide(b2 + pitch - 1);
+		d = loadWide(b2 + pitch);
+		p0 = _mm_add_epi32(p0, _mm_slli_epi32(tmp0, 3));
+		p1 = _mm_add_epi32(p1, _mm_slli_epi32(tmp1, 2));
+		p2 = _mm_add_epi32(p2, _mm_slli_epi32(_mm_add_epi32(tmp0, _mm_add_epi32(dl, d)), 2));
+		p3 = _mm_add_epi32(p3, _mm_slli_epi32(_mm_add_epi32(_mm_add_epi32(tmp1, dl), _mm_sub_epi32(loadWide(b2 + pitch + 1), mul6(d))), 1));
+
+		// HH-band: HPF both vertically and horizontally
+		tmp0 = _mm_add_epi32(loadWide(b3 + backPitch - 1), loadWide(b3 - 1));
+		tmp1 = _mm_add_epi32(loadWide(b3 + backPitch), loadWide(b3));
+		tmp2 = _mm_add_epi32(loadWide(b3 + backPitch + 1), loadWide(b3 + 1));
+		__m128i w3L = vertHPF(b3 - 1, backPitch, pitch);
+		__m128i w3C = vertHPF(b3, backPitch, pitch);
+		p0 = _mm_add_epi32(p0, _mm_slli_epi32(_mm_add_epi32(tmp0, tmp1), 2));
+		p1 = _mm_add_epi32(p1, _mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(tmp0, mul6(tmp1)), tmp2), 1));
+		p2 = _mm_add_epi32(p2, _mm_slli_epi32(_mm_add_epi32(w3L, w3C), 1));
+		p3 = _mm_add_epi32(p3, _mm_add_epi32(_mm_sub_epi32(w3L, mul6(w3C)), vertHPF(b3 + 1, backPitch, pitch)));
+
+		store53Pixels(dst + indx * 2, p0, p1);
+		store53Pixels(dst + dstPitch + indx * 2, p2, p3);
+	}
+
+	for (; indx <= last; indx++)
+		recompose53Pixels(b0Ptr, b1Ptr, b2Ptr, b3Ptr, backPitch, pitch, dst, dstPitch, indx, last);
+}
+
+void IndeoDSP::ffIviOutputRowSSE2(const int16 *src, uint8 *dst, int width) {
+	const __m128i bias = _mm_set1_epi16(128);
+
+	int x = 0;
+	for (; x + 16 <= width; x += 16) {
+		__m128i lo = _mm_adds_epi16(loadRow(src + x), bias);
+		__m128i hi = _mm_adds_epi16(loadRow(src + x + 8), bias);
+		_mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(lo, hi));
+	}
+
+	for (; x < width; x++)
+		dst[x] = avClipUint8(src[x] + 128);
+}
+
+} // End of namespace Indeo
+} // End of namespace Image
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
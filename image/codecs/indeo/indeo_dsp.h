@@ -327,6 +327,58 @@ public:
 	 *  @param[in]      mcType2		Interpolation type for forward reference
 	 */
 	static void ffIviMcAvg4x4NoDelta(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2);
+#ifdef SCUMMVM_SSE2
+	/**
+	 *  SSE2 versions of the motion compensation routines above
+	 */
+	static void ffIviMc8x8DeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType);
+	static void ffIviMc8x8NoDeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType);
+	static void ffIviMcAvg8x8DeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2);
+	static void ffIviMcAvg8x8NoDeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2);
+	static void ffIviMc4x4DeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType);
+	static void ffIviMc4x4NoDeltaSSE2(int16 *buf, const int16 *refBuf, uint32 pitch, int mcType);
+	static void ffIviMcAvg4x4DeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2);
+	static void ffIviMcAvg4x4NoDeltaSSE2(int16 *buf, const int16 *refBuf, const int16 *refBuf2, uint32 pitch, int mcType, int mcType2);
+
+	/**
+	 *  Haar wavelet recomposition of one pair of output lines
+	 *
+	 *  @param[in]  b0Ptr		Pointer to the coefficients of the first band
+	 *  @param[in]  b1Ptr		Pointer to the coefficients of the second band
+	 *  @param[in]  b2Ptr		Pointer to the coefficients of the third band
+	 *  @param[in]  b3Ptr		Pointer to the coefficients of the fourth band
+	 *  @param[out] dst			Pointer to the first of the two output lines
+	 *  @param[in]  dstPitch	Pitch to move to the next output line
+	 *  @param[in]  width		Width of the plane in pixels
+	 */
+	static void ffIviRecomposeHaarRowSSE2(const int16 *b0Ptr, const int16 *b1Ptr, const int16 *b2Ptr, const int16 *b3Ptr,
+		uint8 *dst, int dstPitch, int width);
+
+	/**
+	 *  5/3 wavelet recomposition of one pair of output lines
+	 *
+	 *  @param[in]  b0Ptr		Pointer to the coefficients of the first band
+	 *  @param[in]  b1Ptr		Pointer to the coefficients of the second band
+	 *  @param[in]  b2Ptr		Pointer to the coefficients of the third band
+	 *  @param[in]  b3Ptr		Pointer to the coefficients of the fourth band
+	 *  @param[in]  backPitch	Offset to the coefficient line above (0 on the first line)
+	 *  @param[in]  pitch		Offset to the coefficient line below (0 on the last line)
+	 *  @param[out] dst			Pointer to the first of the two output lines
+	 *  @param[in]  dstPitch	Pitch to move to the next output line
+	 *  @param[in]  width		Width of the plane in pixels
+	 */
+	static void ffIviRecompose53RowSSE2(const int16 *b0Ptr, const int16 *b1Ptr, const int16 *b2Ptr, const int16 *b3Ptr,
+		int backPitch, int pitch, uint8 *dst, int dstPitch, int width);
+
+	/**
+	 *  Convert one line of a non-scalable plane to 8-bit pixels
+	 *
+	 *  @param[in]  src		Pointer to the band coefficients
+	 *  @param[out] dst		Pointer to the output line
+	 *  @param[in]  width	Width of the plane in pixels
+	 */
+	static void ffIviOutputRowSSE2(const int16 *src, uint8 *dst, int width);
+#endif
 };
 
 } // End of namespace Indeo
@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "image/codecs/svq1.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Image {
+
+template<int width>
+static FORCEINLINE __m128i loadPixels(const byte *src) {
+	if (width == 8)
+		return _mm_loadl_epi64((const __m128i *)src);
+	return _mm_loadu_si128((const __m128i *)src);
+}
+
+template<int width>
+static FORCEINLINE void storePixels(byte *dst, __m128i pixels) {
+	if (width == 8)
+		_mm_storel_epi64((__m128i *)dst, pixels);
+	else
+		_mm_storeu_si128((__m128i *)dst, pixels);
+}
+
+// (a + b + c + d + 2) >> 2 on unsigned bytes
+static FORCEINLINE __m128i avg4(__m128i a, __m128i b, __m128i c, __m128i d) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+
+	__m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)),
+	                           _mm_add_epi16(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(d, zero)));
+	__m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)),
+	                           _mm_add_epi16(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(d, zero)));
+	return _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(lo, two), 2), _mm_srli_epi16(_mm_add_epi16(hi, two), 2));
+}
+
+template<int width>
+static void putPixelsSSE2Impl(byte *block, const byte *pixels, int lineSize, int h, int halfpel) {
+	switch (halfpel) {
+	case 0:
+		for (int i = 0; i < h; i++, block += lineSize, pixels += lineSize)
+			storePixels<width>(block, loadPixels<width>(pixels));
+		break;
+	case 1:
+		// pavgb rounds up like rndAvg32()
+		for (int i = 0; i < h; i++, block += lineSize, pixels += lineSize)
+			storePixels<width>(block, _mm_avg_epu8(loadPixels<width>(pixels), loadPixels<width>(pixels + 1)));
+		break;
+	case 2:
+		for (int i = 0; i < h; i++, block += lineSize, pixels += lineSize)
+			storePixels<width>(block, _mm_avg_epu8(loadPixels<width>(pixels), loadPixels<width>(pixels + lineSize)));
+		break;
+	case 3: {
+		__m128i a = loadPixels<width>(pixels);
+		__m128i b = loadPixels<width>(pixels + 1);
+		for (int i = 0; i < h; i++, block += lineSize) {
+			pixels += lineSize;
+			__m128i c = loadPixels<width>(pixels);
+			__m128i d = loadPixels<width>(pixels + 1);
+			storePixels<width>(block, avg4(a, b, c, d));
+			a = c;
+			b = d;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void SVQ1Decoder::putPixelsSSE2(byte *block, const byte *pixels, int lineSize, int width, int h, int halfpel) {
+	if (width == 8)
+		putPixelsSSE2Impl<8>(block, pixels, lineSize, h, halfpel);
+	else
+		putPixelsSSE2Impl<16>(block, pixels, lineSize, h, halfpel);
+}
+
+} // End of namespace Image
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -56,6 +56,12 @@ SVQ1Decoder::SVQ1Decoder(uint16 width, uint16 height) {
 	_frameWidth = _frameHeight = 0;
 	_surface = 0;
 
+#ifdef SCUMMVM_SSE2
+	_useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#else
+	_useSSE2 = false;
+#endif
+
 	_last[0] = 0;
 	_last[1] = 0;
 	_last[2] = 0;
@@ -616,6 +622,59 @@ void SVQ1Decoder::putPixels16XY2C(byte *block, const byte *pixels, int lineSize,
 	putPixels8XY2C(block + 8, pixels + 8, lineSize, h);
 }
 
+// 4 motion compensation functions for the 4 halfpel positions
+void SVQ1Decoder::putPixels8Halfpel(byte *block, const byte *pixels, int lineSize, int halfpel) {
+#ifdef SCUMMVM_SSE2
+	if (_useSSE2) {
+		putPixelsSSE2(block, pixels, lineSize, 8, 8, halfpel);
+		return;
+	}
+#endif
+
+	switch (halfpel) {
+	case 0:
+		putPixels8C(block, pixels, lineSize, 8);
+		break;
+	case 1:
+		putPixels8X2C(block, pixels, lineSize, 8);
+		break;
+	case 2:
+		putPixels8Y2C(block, pixels, lineSize, 8);
+		break;
+	case 3:
+		putPixels8XY2C(block, pixels, lineSize, 8);
+		break;
+	default:
+		break;
+	}
+}
+
+void SVQ1Decoder::putPixels16Halfpel(byte *block, const byte *pixels, int lineSize, int halfpel) {
+#ifdef SCUMMVM_SSE2
+	if (_useSSE2) {
+		putPixelsSSE2(block, pixels, lineSize, 16, 16, halfpel);
+		return;
+	}
+#endif
+
+	switch (halfpel) {
+	case 0:
+		putPixels16C(block, pixels, lineSize, 16);
+		break;
+	case 1:
+		putPixels16X2C(block, pixels, lineSize, 16);
+		break;
+	case 2:
+		putPixels16Y2C(block, pixels, lineSize, 16);
+		break;
+	case 3:
+		putPixels16XY2C(block, pixels, lineSize, 16);
+		break;
+	default:
+		break;
+	}
+}
+
 bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream32BEMSB *ss, byte *current, byte *previous, int pitch,
 		Common::Point *motion, int x, int y) {
 
@@ -646,25 +705,9 @@ bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream32BEMSB *ss, byte *curre
 	const byte *src = &previous[(x + (mv.x >> 1)) + (y + (mv.y >> 1)) * pitch];
 	byte *dst = current;
 
-	// Halfpel motion compensation with rounding (a + b + 1) >> 1.
-	// 4 motion compensation functions for the 4 halfpel positions
+	// Halfpel motion compensation with rounding (a + b + 1) >> 1
 	// for 16x16 blocks
-	switch(((mv.y & 1) << 1) + (mv.x & 1)) {
-	case 0:
-		putPixels16C(dst, src, pitch, 16);
-		break;
-	case 1:
-		putPixels16X2C(dst, src, pitch, 16);
-		break;
-	case 2:
-		putPixels16Y2C(dst, src, pitch, 16);
-		break;
-	case 3:
-		putPixels16XY2C(dst, src, pitch, 16);
-		break;
-	default:
-		break;
-	}
+	putPixels16Halfpel(dst, src, pitch, ((mv.y & 1) << 1) + (mv.x & 1));
 
 	return true;
 }
@@ -728,25 +771,9 @@ bool SVQ1Decoder::svq1MotionInter4vBlock(Common::BitStream32BEMSB *ss, byte *cur
 		const byte *src = &previous[(x + (mvx >> 1)) + (y + (mvy >> 1)) * pitch];
 		byte *dst = current;
 
-		// Halfpel motion compensation with rounding (a + b + 1) >> 1.
-		// 4 motion compensation functions for the 4 halfpel positions
+		// Halfpel motion compensation with rounding (a + b + 1) >> 1
 		// for 8x8 blocks
-		switch(((mvy & 1) << 1) + (mvx & 1)) {
-		case 0:
-			putPixels8C(dst, src, pitch, 8);
-			break;
-		case 1:
-			putPixels8X2C(dst, src, pitch, 8);
-			break;
-		case 2:
-			putPixels8Y2C(dst, src, pitch, 8);
-			break;
-		case 3:
-			putPixels8XY2C(dst, src, pitch, 8);
-			break;
-		default:
-			break;
-		}
+		putPixels8Halfpel(dst, src, pitch, ((mvy & 1) << 1) + (mvx & 1));
 
 		// select next block
 		if (i & 1)
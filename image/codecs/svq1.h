@@ -52,6 +52,7 @@ private:
 	Graphics::Surface *_surface;
 	uint16 _width, _height;
 	uint16 _frameWidth, _frameHeight;
+	bool _useSSE2;
 
 	byte *_last[3];
 
@@ -84,6 +85,12 @@ private:
 	void putPixels16X2C(byte *block, const byte *pixels, int lineSize, int h);
 	void putPixels16Y2C(byte *block, const byte *pixels, int lineSize, int h);
 	void putPixels16XY2C(byte *block, const byte *pixels, int lineSize, int h);
+	void putPixels8Halfpel(byte *block, const byte *pixels, int lineSize, int halfpel);
+	void putPixels16Halfpel(byte *block, const byte *pixels, int lineSize, int halfpel);
+
+#ifdef SCUMMVM_SSE2
+	static void putPixelsSSE2(byte *block, const byte *pixels, int lineSize, int width, int h, int halfpel);
+#endif
 };
 
 } // End of namespace Image
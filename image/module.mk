@@ -40,6 +40,12 @@ MODULE_OBJS := \
 	codecs/indeo/mem.o \
 	codecs/indeo/vlc.o
 
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	codecs/svq1-sse2.o \
+	codecs/indeo/indeo_dsp-sse2.o
+endif
+
 ifdef USE_MPEG2
 MODULE_OBJS += \
 	codecs/mpeg.o
@@ -0,0 +1,158 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+#include "test/bench/alloc_counter.h"
+
+#include <new>
+
+// Only linked into the benchmark runner: replaces the global allocation
+// functions, including the nothrow and aligned variants, with ones counting
+// how often they are called.
+
+static uint32 s_allocationCount = 0;
+
+static void *countedAlloc(size_t size) {
+	s_allocationCount++;
+
+	void *ptr = malloc(size ? size : 1);
+	if (!ptr)
+		error("Out of memory allocating %u bytes", (uint)size);
+	return ptr;
+}
+
+void *operator new(size_t size) {
+	return countedAlloc(size);
+}
+
+void *operator new[](size_t size) {
+	return countedAlloc(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+	s_allocationCount++;
+	return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+	s_allocationCount++;
+	return malloc(size ? size : 1);
+}
+
+void operator delete(void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+	free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+static void *countedAlignedAlloc(size_t size, std::align_val_t alignment) {
+	s_allocationCount++;
+
+	// posix_memalign() isn't portable, so over-allocate and keep the
+	// original pointer right before the aligned block
+	size_t align = MAX<size_t>((size_t)alignment, sizeof(void *));
+	void *base = malloc(size + align + sizeof(void *));
+	if (!base)
+		return nullptr;
+
+	uintptr aligned = ((uintptr)base + sizeof(void *) + align - 1) & ~(uintptr)(align - 1);
+	((void **)aligned)[-1] = base;
+	return (void *)aligned;
+}
+
+static void alignedFree(void *ptr) {
+	if (ptr)
+		free(((void **)ptr)[-1]);
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+	void *ptr = countedAlignedAlloc(size, alignment);
+	if (!ptr)
+		error("Out of memory allocating %u bytes", (uint)size);
+	return ptr;
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+	return operator new(size, alignment);
+}
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+	return countedAlignedAlloc(size, alignment);
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+	return countedAlignedAlloc(size, alignment);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+	alignedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+	alignedFree(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+	alignedFree(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+	alignedFree(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+	alignedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+	alignedFree(ptr);
+}
+#endif
+
+namespace Bench {
+
+uint32 getAllocationCount() {
+	return s_allocationCount;
+}
+
+} // End of namespace Bench
@@ -0,0 +1,517 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/file.h"
+#include "common/fs.h"
+#include "common/memstream.h"
+#include "common/ptr.h"
+#include "common/str.h"
+#include "common/system.h"
+
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+
+#include "image/codecs/cinepak.h"
+#include "image/codecs/indeo/indeo.h"
+#include "image/codecs/indeo/indeo_dsp.h"
+#include "image/codecs/msrle.h"
+#include "image/codecs/qtrle.h"
+
+#include "video/avi_decoder.h"
+#include "video/flic_decoder.h"
+#include "video/qt_decoder.h"
+#include "video/smk_decoder.h"
+#ifdef USE_BINK
+#include "video/bink_decoder.h"
+#endif
+
+#include "test/bench/alloc_counter.h"
+
+#include "../null_osystem.h"
+
+/**
+ * Gives access to the wavelet recomposition of the shared Indeo 4/5 decoder,
+ * with the SSE2 paths switched on or off.
+ */
+class IndeoRecomposer : public Image::Indeo::IndeoDecoderBase {
+public:
+	IndeoRecomposer() : IndeoDecoderBase(16, 16, 24) {}
+
+	const Graphics::Surface *decodeFrame(Common::SeekableReadStream &stream) override { return nullptr; }
+
+	void recompose(const Image::Indeo::IVIPlaneDesc *plane, uint8 *dst, int dstPitch, bool haar, bool simd) {
+		_useSSE2 = simd;
+		if (haar)
+			recomposeHaar(plane, dst, dstPitch);
+		else
+			recompose53(plane, dst, dstPitch);
+	}
+
+protected:
+	int decodePictureHeader() override { return -1; }
+	void switchBuffers() override {}
+	bool isNonNullFrame() const override { return false; }
+	int decodeBandHeader(Image::Indeo::IVIBandDesc *band) override { return -1; }
+	int decodeMbInfo(Image::Indeo::IVIBandDesc *band, Image::Indeo::IVITile *tile) override { return -1; }
+};
+
+/**
+ * Decode throughput of the video and image codecs.
+ *
+ * Run with 'make bench'. Every codec with a built-in encoder below is fed a
+ * synthetic stream; in addition, every video in the 'bench-samples'
+ * directory (relative to the current directory) whose extension maps to a
+ * decoder is decoded from start to end. The results are printed as traces
+ * and written to 'bench.json'.
+ */
+class CodecBenchSuite : public CxxTest::TestSuite {
+	enum {
+		kWidth = 320,
+		kHeight = 240,
+		kMinFrames = 50,
+		kMinMillis = 500
+	};
+
+	struct Result {
+		Common::String name;
+		uint32 frames;
+		uint32 pixels;
+		uint32 millis;
+		uint32 allocations;
+	};
+
+	static Common::Array<Result> &results() {
+		static Common::Array<Result> results;
+		return results;
+	}
+
+	static void addResult(const Common::String &name, uint32 frames, uint32 pixels, uint32 millis, uint32 allocations) {
+		Result result;
+		result.name = name;
+		result.frames = frames;
+		result.pixels = pixels;
+		result.millis = millis ? millis : 1;
+		result.allocations = allocations;
+		results().push_back(result);
+
+		TS_TRACE(Common::String::format("%s: %u frames in %u ms, %.1f frames/s, %.2f ns/pixel, %u allocations",
+			name.c_str(), frames, millis, frames * 1000.0 / result.millis,
+			result.millis * 1000000.0 / ((double)frames * pixels), allocations).c_str());
+	}
+
+	// Simple deterministic generator, so that the streams are the same on
+	// every run
+	uint32 _seed;
+
+	byte nextRandom(uint32 range = 256) {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) % range;
+	}
+
+	// Runs a decoding stage over a whole frame until both kMinFrames and
+	// kMinMillis are reached
+	template<typename T>
+	void benchStage(const Common::String &name, T stage) {
+		uint32 frames = 0;
+		uint32 allocations = Bench::getAllocationCount();
+		uint32 start = g_system->getMillis();
+		uint32 elapsed = 0;
+
+		while (frames < kMinFrames || elapsed < kMinMillis) {
+			stage();
+			frames++;
+			elapsed = g_system->getMillis() - start;
+		}
+
+		addResult(name, frames, kWidth * kHeight, elapsed, Bench::getAllocationCount() - allocations);
+	}
+
+	// Decodes the same frame until both kMinFrames and kMinMillis are reached
+	void benchCodec(const Common::String &name, Image::Codec &codec, const byte *data, uint32 size) {
+		uint32 frames = 0;
+		uint32 allocations = Bench::getAllocationCount();
+		uint32 start = g_system->getMillis();
+		uint32 elapsed = 0;
+
+		while (frames < kMinFrames || elapsed < kMinMillis) {
+			Common::MemoryReadStream stream(data, size);
+			const Graphics::Surface *surface = codec.decodeFrame(stream);
+			TS_ASSERT(surface);
+			if (!surface)
+				return;
+
+			frames++;
+			elapsed = g_system->getMillis() - start;
+		}
+
+		addResult(name, frames, kWidth * kHeight, elapsed, Bench::getAllocationCount() - allocations);
+	}
+
+	/**
+	 * Microsoft RLE, 8 bits: runs and absolute blocks of random lengths.
+	 */
+	void encodeMSRLE8(Common::WriteStream &out) {
+		for (int y = 0; y < kHeight; y++) {
+			int x = 0;
+			while (x < kWidth) {
+				int count = MIN<int>(3 + nextRandom(30), kWidth - x);
+				if (count >= 3 && nextRandom(2)) {
+					out.writeByte(0);
+					out.writeByte(count);
+					for (int i = 0; i < count; i++)
+						out.writeByte(nextRandom());
+					if (count & 1)
+						out.writeByte(0);
+				} else {
+					out.writeByte(count);
+					out.writeByte(nextRandom());
+				}
+				x += count;
+			}
+
+			// End of line, or end of image
+			out.writeByte(0);
+			out.writeByte(y == kHeight - 1 ? 1 : 0);
+		}
+	}
+
+	/**
+	 * QuickTime RLE: runs and literal blocks of random lengths. The 8-bit
+	 * variant works on groups of four pixels.
+	 */
+	void encodeQTRLE(Common::WriteStream &out, int bitsPerPixel) {
+		int bytesPerUnit = (bitsPerPixel == 8) ? 4 : 3;
+		int units = (bitsPerPixel == 8) ? kWidth / 4 : kWidth;
+
+		out.writeUint32BE(0); // chunk size, ignored
+		out.writeUint16BE(0); // no header
+
+		for (int y = 0; y < kHeight; y++) {
+			out.writeByte(1); // no skip
+
+			int x = 0;
+			while (x < units) {
+				int count = MIN<int>(1 + nextRandom(16), units - x);
+				if (nextRandom(2)) {
+					out.writeSByte(-count);
+					for (int i = 0; i < bytesPerUnit; i++)
+						out.writeByte(nextRandom());
+				} else {
+					out.writeSByte(count);
+					for (int i = 0; i < count * bytesPerUnit; i++)
+						out.writeByte(nextRandom());
+				}
+				x += count;
+			}
+
+			out.writeSByte(-1);
+		}
+	}
+
+	/**
+	 * Cinepak: four strips, each with full v1 and v4 codebooks and a random
+	 * mix of v1 and v4 blocks.
+	 */
+	void encodeCinepak(Common::MemoryWriteStreamDynamic &out) {
+		const int stripCount = 4;
+		const int stripHeight = kHeight / stripCount;
+		const int blockCount = (kWidth / 4) * (stripHeight / 4);
+
+		out.writeByte(0); // flags
+		out.writeByte(0); // length, filled in below
+		out.writeUint16BE(0);
+		out.writeUint16BE(kWidth);
+		out.writeUint16BE(kHeight);
+		out.writeUint16BE(stripCount);
+
+		for (int strip = 0; strip < stripCount; strip++) {
+			Common::MemoryWriteStreamDynamic chunks(DisposeAfterUse::YES);
+
+			// Full v4 (0x20) and v1 (0x22) codebooks
+			for (byte id = 0x20; id <= 0x22; id += 2) {
+				chunks.writeByte(id);
+				chunks.writeByte(0);
+				chunks.writeUint16BE(256 * 6 + 4);
+				for (int i = 0; i < 256 * 6; i++)
+					chunks.writeByte(nextRandom());
+			}
+
+			// Vectors, with a flag word selecting v1 or v4 for every 32 blocks
+			Common::MemoryWriteStreamDynamic vectors(DisposeAfterUse::YES);
+			for (int block = 0; block < blockCount; block += 32) {
+				uint32 flags = 0;
+				for (int i = 0; i < 32; i++)
+					flags = (flags << 1) | nextRandom(2);
+				vectors.writeUint32BE(flags);
+
+				for (int i = 0; i < 32 && block + i < blockCount; i++) {
+					int count = (flags & (0x80000000 >> i)) ? 4 : 1;
+					for (int j = 0; j < count; j++)
+						vectors.writeByte(nextRandom());
+				}
+			}
+
+			chunks.writeByte(0x30);
+			chunks.writeByte((vectors.size() + 4) >> 16);
+			chunks.writeUint16BE((vectors.size() + 4) & 0xFFFF);
+			chunks.write(vectors.getData(), vectors.size());
+
+			out.writeUint16BE(0x1000);
+			out.writeUint16BE(chunks.size() + 12);
+			out.writeUint16BE(0);
+			out.writeUint16BE(0);
+			out.writeUint16BE(stripHeight);
+			out.writeUint16BE(kWidth);
+			out.write(chunks.getData(), chunks.size());
+		}
+
+		WRITE_BE_UINT16(out.getData() + 2, out.size() & 0xFFFF);
+		out.getData()[1] = out.size() >> 16;
+	}
+
+	void benchVideo(const Common::String &name, Video::VideoDecoder *decoder, const Common::FSNode &node) {
+		Common::ScopedPtr<Video::VideoDecoder> video(decoder);
+
+		if (!video->loadStream(node.createReadStream())) {
+			TS_WARN(Common::String::format("%s: could not be loaded", name.c_str()).c_str());
+			return;
+		}
+
+		uint32 frames = 0;
+		uint32 allocations = Bench::getAllocationCount();
+		uint32 start = g_system->getMillis();
+
+		while (!video->endOfVideo()) {
+			if (!video->decodeNextFrame())
+				break;
+			frames++;
+		}
+
+		uint32 elapsed = g_system->getMillis() - start;
+		if (frames)
+			addResult(name, frames, video->getWidth() * video->getHeight(), elapsed, Bench::getAllocationCount() - allocations);
+	}
+
+	static Video::VideoDecoder *createVideoDecoder(const Common::String &fileName) {
+		if (fileName.hasSuffixIgnoreCase(".smk"))
+			return new Video::SmackerDecoder();
+#ifdef USE_BINK
+		if (fileName.hasSuffixIgnoreCase(".bik"))
+			return new Video::BinkDecoder();
+#endif
+		if (fileName.hasSuffixIgnoreCase(".fli") || fileName.hasSuffixIgnoreCase(".flc"))
+			return new Video::FlicDecoder();
+		if (fileName.hasSuffixIgnoreCase(".avi"))
+			return new Video::AVIDecoder();
+		if (fileName.hasSuffixIgnoreCase(".mov"))
+			return new Video::QuickTimeDecoder();
+		return 0;
+	}
+
+	static Common::String escapeJSON(const Common::String &str) {
+		Common::String result;
+		for (uint i = 0; i < str.size(); i++) {
+			byte c = str[i];
+			if (c == '"' || c == '\\')
+				result += Common::String::format("\\%c", c);
+			else if (c < 0x20)
+				result += Common::String::format("\\u%04x", c);
+			else
+				result += c;
+		}
+		return result;
+	}
+
+public:
+	void setUp() {
+		if (!g_system)
+			Common::install_null_g_system();
+		Common::enable_null_g_system_cpu_features();
+		_seed = 12345;
+	}
+
+	void test_msrle8() {
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+		encodeMSRLE8(stream);
+
+		Image::MSRLEDecoder codec(kWidth, kHeight, 8);
+		benchCodec("msrle8", codec, stream.getData(), stream.size());
+	}
+
+	void test_qtrle() {
+		static const int bitsPerPixel[] = { 8, 24 };
+
+		for (int i = 0; i < ARRAYSIZE(bitsPerPixel); i++) {
+			Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+			encodeQTRLE(stream, bitsPerPixel[i]);
+
+			Image::QTRLEDecoder codec(kWidth, kHeight, bitsPerPixel[i]);
+			benchCodec(Common::String::format("qtrle%d", bitsPerPixel[i]), codec, stream.getData(), stream.size());
+		}
+	}
+
+	void test_cinepak() {
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::YES);
+		encodeCinepak(stream);
+
+		Image::CinepakDecoder codec32;
+		codec32.setOutputPixelFormat(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+		benchCodec("cinepak-rgba8888", codec32, stream.getData(), stream.size());
+
+		Image::CinepakDecoder codec16;
+		codec16.setOutputPixelFormat(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+		benchCodec("cinepak-rgb565", codec16, stream.getData(), stream.size());
+	}
+
+	/**
+	 * Indeo 4/5: there is no encoder to build a stream from, so the stages
+	 * that do not depend on the bitstream, the motion compensation and the
+	 * wavelet recomposition of a luma plane, are timed on random
+	 * coefficients, with and without SSE2. Complete Indeo videos are
+	 * covered by test_samples() when put in 'bench-samples'.
+	 */
+	void test_indeo() {
+		using namespace Image::Indeo;
+
+		const int bandPitch = kWidth / 2 + 8;
+		const int bandRows = kHeight / 2 + 1;
+		const int pitch = kWidth + 8;
+		const int rows = kHeight + 1;
+
+		Common::Array<int16> coefficients(bandPitch * bandRows * 4);
+		for (uint i = 0; i < coefficients.size(); i++)
+			coefficients[i] = (int16)(nextRandom() - 128) * 4;
+
+		IVIBandDesc bands[4];
+		for (int b = 0; b < 4; b++) {
+			bands[b]._buf = &coefficients[bandPitch * bandRows * b];
+			bands[b]._pitch = bandPitch;
+		}
+
+		IVIPlaneDesc plane;
+		plane._width = kWidth;
+		plane._height = kHeight;
+		plane._numBands = 4;
+		plane._bands = bands;
+
+		Common::Array<byte> pixels(kWidth * kHeight);
+		IndeoRecomposer recomposer;
+
+		Common::Array<int16> ref(pitch * rows), buf(pitch * rows);
+		for (uint i = 0; i < ref.size(); i++)
+			ref[i] = (int16)(nextRandom() - 128);
+
+		struct MCFuncs {
+			const char *name;
+			int size;
+			IviMCFunc mc;
+			IviMCAvgFunc mcAvg;
+		};
+		Common::Array<MCFuncs> mcFuncs;
+		static const MCFuncs scalar[] = {
+			{ "mc8x8", 8, IndeoDSP::ffIviMc8x8Delta, IndeoDSP::ffIviMcAvg8x8Delta },
+			{ "mc4x4", 4, IndeoDSP::ffIviMc4x4Delta, IndeoDSP::ffIviMcAvg4x4Delta }
+		};
+		mcFuncs.push_back(scalar[0]);
+		mcFuncs.push_back(scalar[1]);
+
+		bool simd = false;
+#ifdef SCUMMVM_SSE2
+		simd = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+		static const MCFuncs sse2[] = {
+			{ "mc8x8-sse2", 8, IndeoDSP::ffIviMc8x8DeltaSSE2, IndeoDSP::ffIviMcAvg8x8DeltaSSE2 },
+			{ "mc4x4-sse2", 4, IndeoDSP::ffIviMc4x4DeltaSSE2, IndeoDSP::ffIviMcAvg4x4DeltaSSE2 }
+		};
+		if (simd) {
+			mcFuncs.push_back(sse2[0]);
+			mcFuncs.push_back(sse2[1]);
+		}
+#endif
+
+		for (int i = 0; i < (simd ? 2 : 1); i++) {
+			const bool useSIMD = (i == 1);
+			const char *suffix = useSIMD ? "-sse2" : "";
+
+			benchStage(Common::String::format("indeo5-recompose53%s", suffix), [&]() {
+				recomposer.recompose(&plane, pixels.data(), kWidth, false, useSIMD);
+			});
+			benchStage(Common::String::format("indeo4-recomposehaar%s", suffix), [&]() {
+				recomposer.recompose(&plane, pixels.data(), kWidth, true, useSIMD);
+			});
+		}
+
+		// Every block of the plane, with all four halfpel modes and both
+		// P-frame and B-frame prediction
+		for (uint i = 0; i < mcFuncs.size(); i++) {
+			const MCFuncs &funcs = mcFuncs[i];
+			benchStage(Common::String::format("indeo-%s", funcs.name), [&]() {
+				for (int y = 0; y < kHeight; y += funcs.size) {
+					for (int x = 0; x < kWidth; x += funcs.size) {
+						int offset = y * pitch + x;
+						int mcType = (x / funcs.size + y / funcs.size) & 3;
+						if (mcType & 1)
+							funcs.mcAvg(&buf[offset], &ref[offset], &ref[offset], pitch, mcType, 3 - mcType);
+						else
+							funcs.mc(&buf[offset], &ref[offset], pitch, mcType);
+					}
+				}
+			});
+		}
+	}
+
+	void test_samples() {
+		Common::FSNode dir(Common::Path("bench-samples"));
+		Common::FSList files;
+		if (!dir.isDirectory() || !dir.getChildren(files, Common::FSNode::kListFilesOnly))
+			return;
+
+		Common::sort(files.begin(), files.end());
+		for (Common::FSList::const_iterator it = files.begin(); it != files.end(); ++it) {
+			Video::VideoDecoder *decoder = createVideoDecoder(it->getName());
+			if (decoder)
+				benchVideo(it->getName(), decoder, *it);
+		}
+	}
+
+	void test_write_report() {
+		Common::DumpFile out;
+		if (!out.open(Common::Path("bench.json"))) {
+			TS_WARN("Could not write bench.json");
+			return;
+		}
+
+		out.writeString("[\n");
+		for (uint i = 0; i < results().size(); i++) {
+			const Result &result = results()[i];
+			out.writeString(Common::String::format("\t{ \"name\": \"%s\", \"frames\": %u, \"pixelsPerFrame\": %u, \"milliseconds\": %u, "
+				"\"framesPerSecond\": %.2f, \"nsPerPixel\": %.3f, \"allocations\": %u }%s\n",
+				escapeJSON(result.name).c_str(), result.frames, result.pixels, result.millis,
+				result.frames * 1000.0 / result.millis, result.millis * 1000000.0 / ((double)result.frames * result.pixels),
+				result.allocations, (i + 1 < results().size()) ? "," : ""));
+		}
+		out.writeString("]\n");
+		out.finalize();
+	}
+};
@@ -0,0 +1,110 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "common/str.h"
+#include "common/str-builder.h"
+
+#include "test/bench/alloc_counter.h"
+
+/**
+ * Heap allocations made by the different ways of concatenating strings.
+ *
+ * Run with 'make bench'. The pieces are longer than the built-in storage of
+ * String, so that every new buffer shows up in the allocation count.
+ */
+class StringBenchSuite : public CxxTest::TestSuite {
+	enum {
+		kPieces = 8
+	};
+
+	Common::String _pieces[kPieces];
+
+	// Always takes the copying operator+ overload, like every step of a
+	// chain did before the rvalue overloads were added
+	static Common::String concatCopy(const Common::String &x, const Common::String &y) {
+		return x + y;
+	}
+
+	static Common::String identity(const Common::String line, va_list args) {
+		return line;
+	}
+
+public:
+	void setUp() {
+		for (int i = 0; i < kPieces; i++)
+			_pieces[i] = Common::String::format("piece %d of a longer concatenation", i);
+	}
+
+	void tearDown() {
+		for (int i = 0; i < kPieces; i++)
+			_pieces[i].clear();
+	}
+
+	void test_concatenation() {
+		uint32 allocations = Bench::getAllocationCount();
+		Common::String copied = concatCopy(concatCopy(concatCopy(concatCopy(concatCopy(concatCopy(concatCopy(
+			_pieces[0], _pieces[1]), _pieces[2]), _pieces[3]), _pieces[4]), _pieces[5]), _pieces[6]), _pieces[7]);
+		uint32 copiedAllocations = Bench::getAllocationCount() - allocations;
+
+		allocations = Bench::getAllocationCount();
+		Common::String chained = _pieces[0] + _pieces[1] + _pieces[2] + _pieces[3] + _pieces[4] + _pieces[5] + _pieces[6] + _pieces[7];
+		uint32 chainedAllocations = Bench::getAllocationCount() - allocations;
+
+		allocations = Bench::getAllocationCount();
+		uint32 size = 0;
+		for (int i = 0; i < kPieces; i++)
+			size += _pieces[i].size();
+		Common::StringBuilder builder(size);
+		for (int i = 0; i < kPieces; i++)
+			builder.append(_pieces[i]);
+		Common::String built = builder.finish();
+		uint32 builtAllocations = Bench::getAllocationCount() - allocations;
+
+		TS_TRACE(Common::String::format("%d pieces: %u allocations copying, %u chained, %u with StringBuilder",
+			kPieces, copiedAllocations, chainedAllocations, builtAllocations).c_str());
+
+		TS_ASSERT_EQUALS(chained, copied);
+		TS_ASSERT_EQUALS(built, copied);
+		TS_ASSERT_LESS_THAN_EQUALS((uint32)kPieces - 1, copiedAllocations);
+		// The rvalue chain only reallocates when its buffer has to grow
+		TS_ASSERT_LESS_THAN(chainedAllocations, copiedAllocations);
+		TS_ASSERT_EQUALS(builtAllocations, 1U);
+	}
+
+	void test_for_each_line() {
+		Common::String text;
+		for (int i = 0; i < 100; i++)
+			text += Common::String::format("line %d\n", i);
+
+		// One allocation for the result; the short lines themselves fit
+		// into the built-in storage
+		uint32 allocations = Bench::getAllocationCount();
+		Common::String result = text.forEachLine(identity);
+		allocations = Bench::getAllocationCount() - allocations;
+
+		TS_TRACE(Common::String::format("forEachLine over 100 lines: %u allocations", allocations).c_str());
+
+		TS_ASSERT_EQUALS(result, text);
+		TS_ASSERT_EQUALS(allocations, 1U);
+	}
+};
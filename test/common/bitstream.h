@@ -255,4 +255,42 @@ public:
 		tmpl_align_16<Common::MemoryReadStream, Common::BitStream16BELSB>();
 		tmpl_align_16<Common::BitStreamMemoryStream, Common::BitStreamMemory16BELSB>();
 	}
+
+private:
+	template<class MS, class BS>
+	void tmpl_long_reads(bool msb) {
+		byte contents[64];
+		for (int i = 0; i < 64; i++)
+			contents[i] = i * 37 + 11;
+
+		MS ms(contents, sizeof(contents));
+
+		BS bs(ms);
+
+		// Reads of varying sizes, crossing several container refills
+		uint32 pos = 0;
+		for (uint32 n = 1; pos + n <= sizeof(contents) * 8; n = (n % 17) + 1) {
+			uint32 expected = 0;
+			for (uint32 i = 0; i < n; i++) {
+				uint32 bitPos = pos + i;
+				uint32 bit = msb ? (contents[bitPos / 8] >> (7 - bitPos % 8)) & 1 : (contents[bitPos / 8] >> (bitPos % 8)) & 1;
+				expected |= msb ? bit << (n - 1 - i) : bit << i;
+			}
+
+			TS_ASSERT_EQUALS(bs.peekBits(n), expected);
+			TS_ASSERT_EQUALS(bs.getBits(n), expected);
+			pos += n;
+			TS_ASSERT_EQUALS(bs.pos(), pos);
+		}
+		TS_ASSERT(!bs.eos());
+	}
+public:
+	void test_long_reads() {
+		tmpl_long_reads<Common::MemoryReadStream, Common::BitStream8MSB>(true);
+		tmpl_long_reads<Common::BitStreamMemoryStream, Common::BitStreamMemory8MSB>(true);
+		tmpl_long_reads<Common::MemoryReadStream, Common::BitStream32BEMSB>(true);
+		tmpl_long_reads<Common::MemoryReadStream, Common::BitStream8LSB>(false);
+		tmpl_long_reads<Common::BitStreamMemoryStream, Common::BitStreamMemory32LELSB>(false);
+		tmpl_long_reads<Common::MemoryReadStream, Common::BitStream16LELSB>(false);
+	}
 };
@@ -2,6 +2,46 @@
 #include "common/compression/huffman.h"
 #include "common/bitstream.h"
 #include "common/memstream.h"
+#include "common/str.h"
+
+// The Huffman tables of Bink video, from video/binkdata.h
+static const uint32 binkHuffmanCodes[16][16] = {
+	{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F },
+	{ 0x00, 0x01, 0x03, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x13, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F },
+	{ 0x00, 0x02, 0x01, 0x09, 0x05, 0x15, 0x0D, 0x1D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F },
+	{ 0x00, 0x02, 0x06, 0x01, 0x09, 0x05, 0x0D, 0x1D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F },
+	{ 0x00, 0x04, 0x02, 0x06, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F },
+	{ 0x00, 0x04, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x17, 0x0F, 0x1F },
+	{ 0x00, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F },
+	{ 0x00, 0x01, 0x05, 0x03, 0x13, 0x0B, 0x1B, 0x3B, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x01, 0x03, 0x13, 0x0B, 0x2B, 0x1B, 0x3B, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x01, 0x05, 0x0D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x02, 0x01, 0x05, 0x0D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x02, 0x01, 0x03, 0x13, 0x0B, 0x1B, 0x3B, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F },
+	{ 0x00, 0x01, 0x05, 0x03, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F },
+	{ 0x00, 0x01, 0x05, 0x03, 0x07, 0x17, 0x37, 0x77, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F },
+	{ 0x00, 0x02, 0x01, 0x05, 0x03, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F }
+};
+
+static const uint8 binkHuffmanLengths[16][16] = {
+	{ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+	{ 1, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 2, 2, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 2, 3, 3, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5 },
+	{ 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5 },
+	{ 1, 3, 3, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 1, 2, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 1, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 2, 2, 3, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6 },
+	{ 1, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6 },
+	{ 2, 2, 2, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 },
+	{ 1, 3, 3, 3, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7 },
+	{ 1, 3, 3, 3, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 },
+	{ 2, 2, 3, 3, 3, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7 }
+};
 
 /**
 * A test suite for the Huffman decoder in common/compression/huffman.h
@@ -94,4 +134,127 @@ class HuffmanTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[5]);
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[6]);
 	}
+
+	void test_get_long_codes() {
+
+		/*
+		 * Codes longer than the first lookup table, going through
+		 * the second-level tables, in both bit orders. In stream order:
+		 *
+		 * 0=0, 1=10, 2=110, ..., 10=11111111110,
+		 * 11=111111111110, 12=111111111111
+		 *
+		 * MSB streams start with the top bit of a code, LSB streams
+		 * with its bit 0, so the LSB codes are the mirrored MSB ones.
+		 */
+
+		const uint32 codeCount = 13;
+		uint8  lengths[codeCount];
+		uint32 codes[codeCount];
+		for (uint32 i = 0; i < codeCount; i++) {
+			lengths[i] = MIN<uint32>(i + 1, 12);
+			codes[i]   = ((1 << lengths[i]) - 1) & ~1;
+		}
+		codes[12] |= 1;
+
+		uint32 lsbCodes[codeCount];
+		for (uint32 i = 0; i < codeCount; i++) {
+			lsbCodes[i] = 0;
+			for (uint32 b = 0; b < lengths[i]; b++)
+				lsbCodes[i] |= ((codes[i] >> b) & 1) << (lengths[i] - 1 - b);
+		}
+
+		const uint32 sequence[] = {12, 0, 11, 5, 10, 1, 12, 9, 2, 12, 12, 3, 4, 6, 7, 8, 11, 0};
+		const uint32 count = ARRAYSIZE(sequence);
+
+		// Write the codes in stream order, filling each byte from its MSB or LSB
+		byte msb[32], lsb[32];
+		memset(msb, 0, sizeof(msb));
+		memset(lsb, 0, sizeof(lsb));
+
+		uint32 pos = 0;
+		for (uint32 i = 0; i < count; i++) {
+			for (int b = lengths[sequence[i]] - 1; b >= 0; b--, pos++) {
+				if ((codes[sequence[i]] >> b) & 1) {
+					msb[pos / 8] |= 0x80 >> (pos % 8);
+					lsb[pos / 8] |= 1 << (pos % 8);
+				}
+			}
+		}
+
+		Common::Huffman<Common::BitStream8MSB> hMSB(0, codeCount, codes, lengths);
+		Common::MemoryReadStream msMSB(msb, sizeof(msb));
+		Common::BitStream8MSB bsMSB(msMSB);
+
+		for (uint32 i = 0; i < count; i++)
+			TS_ASSERT_EQUALS(hMSB.getSymbol(bsMSB), sequence[i]);
+		TS_ASSERT_EQUALS(bsMSB.pos(), pos);
+
+		Common::Huffman<Common::BitStream8LSB> hLSB(0, codeCount, lsbCodes, lengths);
+		Common::MemoryReadStream msLSB(lsb, sizeof(lsb));
+		Common::BitStream8LSB bsLSB(msLSB);
+
+		byte decoded[count];
+		hLSB.getSymbols(bsLSB, decoded, count);
+
+		for (uint32 i = 0; i < count; i++)
+			TS_ASSERT_EQUALS(decoded[i], sequence[i]);
+		TS_ASSERT_EQUALS(bsLSB.pos(), pos);
+	}
+
+	void test_get_lsb_code_order() {
+
+		/*
+		 * On LSB streams, bit 0 of a code is read first. With the
+		 * 2-bit codes 0=10, 1=01, 2=00, 3=11 and the stream bits
+		 * 1 then 0, this is the code 01.
+		 */
+
+		const uint8 lengths[] = {2, 2, 2, 2};
+		const uint32 codes[]  = {0x2, 0x1, 0x0, 0x3};
+
+		Common::Huffman<Common::BitStream8LSB> h(0, 4, codes, lengths);
+
+		byte input[] = {0x01};
+		Common::MemoryReadStream ms(input, sizeof(input));
+		Common::BitStream8LSB bs(ms);
+
+		TS_ASSERT_EQUALS(h.getSymbol(bs), 1u);
+		TS_ASSERT_EQUALS(bs.pos(), 2u);
+	}
+
+	void test_get_bink_codes() {
+
+		/*
+		 * The Bink tables are written for LSB-first 32-bit streams.
+		 * Decode every symbol of each of them from such a stream.
+		 */
+
+		for (uint32 t = 0; t < 16; t++) {
+			const uint32 *codes = binkHuffmanCodes[t];
+			const uint8 *lengths = binkHuffmanLengths[t];
+
+			const uint32 sequence[] = {0, 15, 1, 14, 2, 13, 3, 12, 4, 11, 5, 10, 6, 9, 7, 8, 0, 0, 15, 15};
+			const uint32 count = ARRAYSIZE(sequence);
+
+			byte input[64];
+			memset(input, 0, sizeof(input));
+
+			uint32 pos = 0;
+			for (uint32 i = 0; i < count; i++) {
+				for (uint32 b = 0; b < lengths[sequence[i]]; b++, pos++) {
+					if ((codes[sequence[i]] >> b) & 1)
+						input[pos / 8] |= 1 << (pos % 8);
+				}
+			}
+
+			Common::Huffman<Common::BitStream32LELSB> h(lengths[15], 16, codes, lengths);
+			Common::MemoryReadStream ms(input, sizeof(input));
+			Common::BitStream32LELSB bs(ms);
+
+			for (uint32 i = 0; i < count; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("table %d, symbol %d", t, i).c_str(), h.getSymbol(bs), sequence[i]);
+			TS_ASSERT_EQUALS(bs.pos(), pos);
+		}
+	}
 };
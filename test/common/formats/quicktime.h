@@ -1,4 +1,5 @@
 #include <cxxtest/TestSuite.h>
+#include "common/memstream.h"
 #include "common/util.h"
 #include "common/formats/quicktime.h"
 
@@ -38,6 +39,20 @@ public:
 };
 
 class QuicktimeParserTestSuite : public CxxTest::TestSuite {
+	static void writeAtom(Common::WriteStream &out, uint32 type, Common::MemoryWriteStreamDynamic &payload) {
+		out.writeUint32BE(payload.size() + 8);
+		out.writeUint32BE(type);
+		out.write(payload.getData(), payload.size());
+	}
+
+	static void writeFullAtom(Common::WriteStream &out, uint32 type, const uint32 *values, uint32 count) {
+		Common::MemoryWriteStreamDynamic payload(DisposeAfterUse::YES);
+		payload.writeUint32BE(0); // version + flags
+		for (uint32 i = 0; i < count; i++)
+			payload.writeUint32BE(values[i]);
+		writeAtom(out, type, payload);
+	}
+
 public:
 	void test_streamAtEOS() {
 		QuickTimeTestParser parser;
@@ -80,4 +95,60 @@ public:
 		TS_ASSERT(!result);
 	}
 
+	void test_sampleIndex() {
+		// A video track with five samples spread over four chunks, with
+		// two sample descriptions and two sample durations
+		static const uint32 stts[] = { 2, 2, 5, 3, 7 };
+		static const uint32 stsc[] = { 2, 1, 2, 1, 2, 1, 2 };
+		static const uint32 stco[] = { 4, 100, 200, 300, 400 };
+		static const uint32 stsz[] = { 0, 5, 10, 20, 30, 40, 50 };
+		static const uint32 hdlr[] = { MKTAG('m', 'h', 'l', 'r'), MKTAG('v', 'i', 'd', 'e'), 0, 0, 0 };
+
+		Common::MemoryWriteStreamDynamic stbl(DisposeAfterUse::YES);
+		writeFullAtom(stbl, MKTAG('s', 't', 't', 's'), stts, ARRAYSIZE(stts));
+		writeFullAtom(stbl, MKTAG('s', 't', 's', 'c'), stsc, ARRAYSIZE(stsc));
+		writeFullAtom(stbl, MKTAG('s', 't', 'c', 'o'), stco, ARRAYSIZE(stco));
+		writeFullAtom(stbl, MKTAG('s', 't', 's', 'z'), stsz, ARRAYSIZE(stsz));
+
+		Common::MemoryWriteStreamDynamic minf(DisposeAfterUse::YES);
+		writeAtom(minf, MKTAG('s', 't', 'b', 'l'), stbl);
+
+		Common::MemoryWriteStreamDynamic mdia(DisposeAfterUse::YES);
+		writeFullAtom(mdia, MKTAG('h', 'd', 'l', 'r'), hdlr, ARRAYSIZE(hdlr));
+		writeAtom(mdia, MKTAG('m', 'i', 'n', 'f'), minf);
+
+		Common::MemoryWriteStreamDynamic trak(DisposeAfterUse::YES);
+		writeAtom(trak, MKTAG('m', 'd', 'i', 'a'), mdia);
+
+		Common::MemoryWriteStreamDynamic moov(DisposeAfterUse::YES);
+		writeAtom(moov, MKTAG('t', 'r', 'a', 'k'), trak);
+
+		Common::MemoryWriteStreamDynamic file(DisposeAfterUse::YES);
+		writeAtom(file, MKTAG('m', 'o', 'o', 'v'), moov);
+
+		QuickTimeTestParser parser;
+		Common::MemoryReadStream stream(file.getData(), file.size());
+		TS_ASSERT(parser.parseStream(&stream, DisposeAfterUse::NO));
+		TS_ASSERT_EQUALS(parser.getTracks().size(), 1u);
+		if (parser.getTracks().empty())
+			return;
+
+		static const uint32 offsets[] = { 100, 110, 200, 300, 400 };
+		static const uint32 descIds[] = { 1, 1, 2, 2, 2 };
+
+		const auto &sampleIndex = parser.getTracks()[0]->sampleIndex;
+		TS_ASSERT_EQUALS(sampleIndex.size(), 5u);
+		for (uint32 i = 0; i < sampleIndex.size() && i < 5; i++) {
+			TS_ASSERT_EQUALS(sampleIndex[i].offset, offsets[i]);
+			TS_ASSERT_EQUALS(sampleIndex[i].size, stsz[i + 2]);
+			TS_ASSERT_EQUALS(sampleIndex[i].descId, descIds[i]);
+		}
+
+		const auto *timeToSample = parser.getTracks()[0]->timeToSample;
+		TS_ASSERT_EQUALS(timeToSample[0].firstSample, 0u);
+		TS_ASSERT_EQUALS(timeToSample[0].startTime, 0u);
+		TS_ASSERT_EQUALS(timeToSample[1].firstSample, 2u);
+		TS_ASSERT_EQUALS(timeToSample[1].startTime, 10u);
+	}
+
 };
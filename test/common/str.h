@@ -1,6 +1,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "common/str.h"
+#include "common/str-builder.h"
 #include "common/ustr.h"
 
 #include "test/common/str-helper.h"
@@ -296,6 +297,58 @@ class StringTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(str2, "01234567890123456789012345678901");
 	}
 
+	void test_concat_chain() {
+		Common::String a("This is a rather long string, ");
+		Common::String b("which does not fit ");
+		Common::String str = a + b + "the internal storage" + '.';
+		TS_ASSERT_EQUALS(str, "This is a rather long string, which does not fit the internal storage.");
+		TS_ASSERT_EQUALS(a, "This is a rather long string, ");
+		TS_ASSERT_EQUALS(b, "which does not fit ");
+
+		str = "x" + a + a;
+		TS_ASSERT_EQUALS(str, "xThis is a rather long string, This is a rather long string, ");
+	}
+
+	void test_builder() {
+		Common::StringBuilder builder(100);
+		const char *storage = builder.str().c_str();
+
+		builder.append("This is ").append(Common::String("a string")).append(',');
+		builder += " built";
+		builder.append(" piece by piece and more", 15);
+		TS_ASSERT_EQUALS(builder.size(), 38u);
+		TS_ASSERT_EQUALS(builder.str(), "This is a string, built piece by piece");
+
+		// Everything fit in the reserved capacity, and finishing hands
+		// the storage over instead of copying it
+		TS_ASSERT(builder.str().c_str() == storage);
+		Common::String str = builder.finish();
+		TS_ASSERT(str.c_str() == storage);
+		TS_ASSERT_EQUALS(str, "This is a string, built piece by piece");
+		TS_ASSERT(builder.empty());
+	}
+
+	void test_reserve_shared() {
+		// Reserving less than the contents of a shared string must not
+		// move them into the too small internal storage
+		Common::String a("This string is longer than the internal storage");
+		Common::String b = a;
+		b.reserve(0);
+		TS_ASSERT_EQUALS(b, "This string is longer than the internal storage");
+
+		b += '!';
+		TS_ASSERT_EQUALS(a, "This string is longer than the internal storage");
+		TS_ASSERT_EQUALS(b, "This string is longer than the internal storage!");
+
+		Common::StringBuilder builder;
+		builder.append(a);
+		Common::String copy = builder.str();
+		builder.reserve(1);
+		builder += '?';
+		TS_ASSERT_EQUALS(builder.str(), "This string is longer than the internal storage?");
+		TS_ASSERT_EQUALS(copy, "This string is longer than the internal storage");
+	}
+
 	void test_lastPathComponent() {
 		TS_ASSERT_EQUALS(Common::lastPathComponent("/", '/'), "");
 		TS_ASSERT_EQUALS(Common::lastPathComponent("/foo/bar", '/'), "bar");
@@ -0,0 +1,104 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/str.h"
+
+#include "engines/scumm/smush/codec47.h"
+
+/**
+ * Decodes a hand-built codec47 frame made of solid colour blocks, which go
+ * through the word-sized fill macros, and compares it with the same blocks
+ * drawn one pixel at a time.
+ */
+class Codec47TestSuite : public CxxTest::TestSuite {
+	enum {
+		kWidth = 32,
+		kHeight = 16
+	};
+
+	byte _expected[kWidth * kHeight];
+
+	void fill(int x, int y, int size, byte color) {
+		for (int i = 0; i < size; i++)
+			memset(_expected + (y + i) * kWidth + x, color, size);
+	}
+
+public:
+	void test_fills() {
+		static const byte params[4] = { 0x21, 0x22, 0x23, 0x24 };
+		static const byte prevColor = 0x31, motionColor = 0x32;
+
+		static const byte blocks[] = {
+			// 8x8 blocks: a colour, and a parameter colour
+			0xFE, 0x11,
+			0xF8,
+			// 4x4 blocks
+			0xFF,
+				0xFE, 0x12,
+				0xF9,
+				// 2x2 blocks, including raw pixels
+				0xFF,
+					0xFE, 0x13,
+					0xFA,
+					0xFF, 0x41, 0x42, 0x43, 0x44,
+					0xFB,
+				0xFC,
+			// Copies from the previous buffer and motion from the other one
+			0xFC,
+			0x00,
+			0xFB,
+			0xFE, 0xFF,
+			0xFF,
+				0xFE, 0x80,
+				0xFF,
+					0xFE, 0x7F,
+					0xFE, 0x01,
+					0xFA,
+					0xFC,
+				0xF8,
+				0xFE, 0x00
+		};
+
+		byte src[26 + sizeof(blocks)];
+		memset(src, 0, sizeof(src));
+		src[2] = 2; // Block coded frame
+		memcpy(src + 8, params, sizeof(params));
+		src[12] = prevColor;
+		src[13] = motionColor;
+		memcpy(src + 26, blocks, sizeof(blocks));
+
+		fill(0, 0, 8, 0x11);
+		fill(8, 0, 8, params[0]);
+		fill(16, 0, 4, 0x12);
+		fill(20, 0, 4, params[1]);
+		fill(16, 4, 2, 0x13);
+		fill(18, 4, 2, params[2]);
+		_expected[6 * kWidth + 16] = 0x41;
+		_expected[6 * kWidth + 17] = 0x42;
+		_expected[7 * kWidth + 16] = 0x43;
+		_expected[7 * kWidth + 17] = 0x44;
+		fill(18, 6, 2, params[3]);
+		fill(20, 4, 4, prevColor);
+		fill(24, 0, 8, prevColor);
+		fill(0, 8, 8, motionColor);
+		fill(8, 8, 8, params[3]);
+		fill(16, 8, 8, 0xFF);
+		fill(24, 8, 4, 0x80);
+		fill(28, 8, 2, 0x7F);
+		fill(30, 8, 2, 0x01);
+		fill(28, 10, 2, params[2]);
+		fill(30, 10, 2, prevColor);
+		fill(24, 12, 4, params[0]);
+		fill(28, 12, 4, 0x00);
+
+		byte dst[kWidth * kHeight];
+		memset(dst, 0xEE, sizeof(dst));
+
+		Scumm::SmushDeltaGlyphsDecoder decoder(kWidth, kHeight);
+		TS_ASSERT(decoder.decode(dst, src));
+
+		for (int y = 0; y < kHeight; y++) {
+			for (int x = 0; x < kWidth; x++)
+				TSM_ASSERT_EQUALS(Common::String::format("at %d,%d", x, y).c_str(), dst[y * kWidth + x], _expected[y * kWidth + x]);
+		}
+	}
+};
@@ -0,0 +1,169 @@
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#include "common/str.h"
+
+#include "image/codecs/indeo/indeo.h"
+#include "image/codecs/indeo/indeo_dsp.h"
+
+#include "../null_osystem.h"
+
+namespace {
+
+/**
+ * Gives access to the wavelet recomposition of the shared Indeo 4/5 decoder,
+ * with the SSE2 paths switched on or off.
+ */
+class IndeoRecomposer : public Image::Indeo::IndeoDecoderBase {
+public:
+	IndeoRecomposer() : IndeoDecoderBase(16, 16, 24) {}
+
+	const Graphics::Surface *decodeFrame(Common::SeekableReadStream &stream) override { return nullptr; }
+
+	void recompose(const Image::Indeo::IVIPlaneDesc *plane, uint8 *dst, int dstPitch, bool haar, bool simd) {
+		_useSSE2 = simd;
+		if (haar)
+			recomposeHaar(plane, dst, dstPitch);
+		else
+			recompose53(plane, dst, dstPitch);
+	}
+
+protected:
+	int decodePictureHeader() override { return -1; }
+	void switchBuffers() override {}
+	bool isNonNullFrame() const override { return false; }
+	int decodeBandHeader(Image::Indeo::IVIBandDesc *band) override { return -1; }
+	int decodeMbInfo(Image::Indeo::IVIBandDesc *band, Image::Indeo::IVITile *tile) override { return -1; }
+};
+
+} // End of anonymous namespace
+
+class IndeoDSPTestSuite : public CxxTest::TestSuite {
+	enum {
+		kPitch = 40,
+		kRows = 24
+	};
+
+	// Room for the halfpel neighbours of the blocks and the band lines
+	int16 _ref[kPitch * kRows];
+	int16 _ref2[kPitch * kRows];
+	int16 _bands[4][kPitch * kRows];
+
+	// Covers the whole int16 range, so that the wrap-around and the
+	// clipping of the results are exercised too
+	void fill(int16 *buf, int count, uint32 &seed) {
+		for (int i = 0; i < count; i++) {
+			seed = seed * 1103515245 + 12345;
+			buf[i] = (int16)(seed >> 16);
+		}
+	}
+
+	static bool hasSSE2() {
+#ifdef SCUMMVM_SSE2
+		return instrset_detect() >= 2;
+#else
+		return false;
+#endif
+	}
+
+	void compareMC(Image::Indeo::IviMCFunc reference, Image::Indeo::IviMCFunc simd, int size, const char *name) {
+		for (int mcType = 0; mcType < 4; mcType++) {
+			int16 expected[kPitch * 8], result[kPitch * 8];
+			uint32 seed = 1;
+			fill(expected, ARRAYSIZE(expected), seed);
+			memcpy(result, expected, sizeof(result));
+
+			reference(expected, _ref, kPitch, mcType);
+			simd(result, _ref, kPitch, mcType);
+
+			for (int i = 0; i < size * kPitch; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("%s, type %d at %d", name, mcType, i).c_str(), result[i], expected[i]);
+		}
+	}
+
+	void compareMCAvg(Image::Indeo::IviMCAvgFunc reference, Image::Indeo::IviMCAvgFunc simd, int size, const char *name) {
+		for (int mcType = 0; mcType < 4; mcType++) {
+			int16 expected[kPitch * 8], result[kPitch * 8];
+			uint32 seed = 2;
+			fill(expected, ARRAYSIZE(expected), seed);
+			memcpy(result, expected, sizeof(result));
+
+			reference(expected, _ref, _ref2, kPitch, mcType, 3 - mcType);
+			simd(result, _ref, _ref2, kPitch, mcType, 3 - mcType);
+
+			for (int i = 0; i < size * kPitch; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("%s, type %d at %d", name, mcType, i).c_str(), result[i], expected[i]);
+		}
+	}
+
+	void compareRecomposition(int width, int height, bool haar) {
+		Image::Indeo::IVIBandDesc bands[4];
+		for (int b = 0; b < 4; b++) {
+			bands[b]._buf = _bands[b];
+			bands[b]._pitch = kPitch;
+		}
+
+		Image::Indeo::IVIPlaneDesc plane;
+		plane._width = width;
+		plane._height = height;
+		plane._numBands = 4;
+		plane._bands = bands;
+
+		byte expected[kPitch * 2 * kRows], result[kPitch * 2 * kRows];
+		memset(expected, 0, sizeof(expected));
+		memset(result, 0, sizeof(result));
+
+		IndeoRecomposer recomposer;
+		recomposer.recompose(&plane, expected, kPitch * 2, haar, false);
+		recomposer.recompose(&plane, result, kPitch * 2, haar, true);
+
+		for (int i = 0; i < ARRAYSIZE(expected); i++) {
+			TSM_ASSERT_EQUALS(Common::String::format("%s %dx%d at %d", haar ? "haar" : "5/3", width, height, i).c_str(),
+				result[i], expected[i]);
+		}
+	}
+
+public:
+	void setUp() {
+		uint32 seed = 12345;
+		fill(_ref, ARRAYSIZE(_ref), seed);
+		fill(_ref2, ARRAYSIZE(_ref2), seed);
+		for (int b = 0; b < 4; b++)
+			fill(_bands[b], ARRAYSIZE(_bands[b]), seed);
+	}
+
+	void test_mc_simd_matches_scalar() {
+#ifdef SCUMMVM_SSE2
+		if (!hasSSE2())
+			return;
+
+		using namespace Image::Indeo;
+
+		compareMC(IndeoDSP::ffIviMc8x8Delta, IndeoDSP::ffIviMc8x8DeltaSSE2, 8, "mc8x8 delta");
+		compareMC(IndeoDSP::ffIviMc8x8NoDelta, IndeoDSP::ffIviMc8x8NoDeltaSSE2, 8, "mc8x8");
+		compareMC(IndeoDSP::ffIviMc4x4Delta, IndeoDSP::ffIviMc4x4DeltaSSE2, 4, "mc4x4 delta");
+		compareMC(IndeoDSP::ffIviMc4x4NoDelta, IndeoDSP::ffIviMc4x4NoDeltaSSE2, 4, "mc4x4");
+		compareMCAvg(IndeoDSP::ffIviMcAvg8x8Delta, IndeoDSP::ffIviMcAvg8x8DeltaSSE2, 8, "mcavg8x8 delta");
+		compareMCAvg(IndeoDSP::ffIviMcAvg8x8NoDelta, IndeoDSP::ffIviMcAvg8x8NoDeltaSSE2, 8, "mcavg8x8");
+		compareMCAvg(IndeoDSP::ffIviMcAvg4x4Delta, IndeoDSP::ffIviMcAvg4x4DeltaSSE2, 4, "mcavg4x4 delta");
+		compareMCAvg(IndeoDSP::ffIviMcAvg4x4NoDelta, IndeoDSP::ffIviMcAvg4x4NoDeltaSSE2, 4, "mcavg4x4");
+#endif
+	}
+
+	void test_recomposition_simd_matches_scalar() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		if (!hasSSE2())
+			return;
+
+		Common::install_null_g_system();
+
+		// Widths that are not a multiple of the SIMD step, odd ones and the
+		// smallest possible, to cover the edge columns and the tails
+		static const int sizes[][2] = { { 64, 16 }, { 46, 10 }, { 22, 4 }, { 18, 6 }, { 2, 2 } };
+		for (int i = 0; i < ARRAYSIZE(sizes); i++) {
+			compareRecomposition(sizes[i][0], sizes[i][1], false);
+			compareRecomposition(sizes[i][0], sizes[i][1], true);
+		}
+#endif
+	}
+};
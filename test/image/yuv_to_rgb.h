@@ -0,0 +1,102 @@
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#include "common/str.h"
+
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+class YUVToRGBTestSuite : public CxxTest::TestSuite {
+	enum {
+		kWidth = 44,   // Not a multiple of 8, to exercise the tail of the SIMD rows
+		kHeight = 12,
+		kPitch = 64
+	};
+
+	byte _y[kPitch * kHeight];
+	byte _u[kPitch * (kHeight + 1)];
+	byte _v[kPitch * (kHeight + 1)];
+	byte _a[kPitch * kHeight];
+
+	void fillPlanes() {
+		// Cover the whole range of values, including the ones that end up
+		// clipped, with a simple pseudo-random sequence
+		uint32 seed = 12345;
+		for (int i = 0; i < kPitch * kHeight; i++) {
+			seed = seed * 1103515245 + 12345;
+			_y[i] = seed >> 16;
+			_a[i] = seed >> 24;
+		}
+		for (int i = 0; i < kPitch * (kHeight + 1); i++) {
+			seed = seed * 1103515245 + 12345;
+			_u[i] = seed >> 16;
+			_v[i] = seed >> 24;
+		}
+	}
+
+	void convert(Graphics::Surface &dst, int mode, Graphics::YUVToRGBManager::LuminanceScale scale, bool simd) {
+		YUVToRGBMan.setSIMDEnabled(simd);
+		switch (mode) {
+		case 0:
+			YUVToRGBMan.convert444(&dst, scale, _y, _u, _v, kWidth, kHeight, kPitch, kPitch);
+			break;
+		case 1:
+			YUVToRGBMan.convert422(&dst, scale, _y, _u, _v, kWidth, kHeight, kPitch, kPitch);
+			break;
+		case 2:
+			YUVToRGBMan.convert420(&dst, scale, _y, _u, _v, kWidth, kHeight, kPitch, kPitch);
+			break;
+		case 3:
+			YUVToRGBMan.convert420Alpha(&dst, scale, _y, _u, _v, _a, kWidth, kHeight, kPitch, kPitch);
+			break;
+		default:
+			YUVToRGBMan.convert410(&dst, scale, _y, _u, _v, kWidth, kHeight, kPitch, kPitch);
+			break;
+		}
+	}
+
+	void compareWithTables(const Graphics::PixelFormat &format) {
+		fillPlanes();
+
+		for (int mode = 0; mode < 5; mode++) {
+			for (int scale = 0; scale < 2; scale++) {
+				Graphics::Surface reference, result;
+				reference.create(kWidth, kHeight, format);
+				result.create(kWidth, kHeight, format);
+
+				convert(reference, mode, (Graphics::YUVToRGBManager::LuminanceScale)scale, false);
+				convert(result, mode, (Graphics::YUVToRGBManager::LuminanceScale)scale, true);
+
+				for (int y = 0; y < kHeight; y++) {
+					for (int x = 0; x < kWidth; x++) {
+						TSM_ASSERT_EQUALS(Common::String::format("mode %d, scale %d at %d,%d", mode, scale, x, y).c_str(),
+							result.getPixel(x, y), reference.getPixel(x, y));
+					}
+				}
+
+				reference.free();
+				result.free();
+			}
+		}
+	}
+
+public:
+	void test_simd_matches_tables() {
+		bool simd = false;
+#ifdef SCUMMVM_SSE2
+		simd = instrset_detect() >= 2;
+#endif
+		if (!simd)
+			return;
+
+		// The manager is a singleton, leave it as it was found
+		bool wasEnabled = YUVToRGBMan.isSIMDEnabled();
+
+		compareWithTables(Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24));
+		compareWithTables(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+		compareWithTables(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+		compareWithTables(Graphics::PixelFormat(2, 5, 5, 5, 1, 10, 5, 0, 15));
+
+		YUVToRGBMan.setSIMDEnabled(wasEnabled);
+	}
+};
@@ -17,6 +17,10 @@ void Common::install_null_g_system() {
 	g_system = OSystem_NULL_create(silenceLogs);
 }
 
+void Common::enable_null_g_system_cpu_features() {
+	g_nullReportCpuSSE2 = true;
+}
+
 void OSystem_NULL::quit() {
 	abort();
 }
@@ -3,6 +3,8 @@
 namespace Common {
 #if defined(POSIX) || defined(WIN32)
 void install_null_g_system();
+// Make the null system report the SIMD features the compiler targets
+void enable_null_g_system_cpu_features();
 #define NULL_OSYSTEM_IS_AVAILABLE 1
 #else
 #define NULL_OSYSTEM_IS_AVAILABLE 0
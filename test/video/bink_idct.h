@@ -0,0 +1,88 @@
+#include <cxxtest/TestSuite.h>
+#include "test/instrset_detect.h"
+
+#include "common/str.h"
+
+#include "video/bink_decoder.h"
+
+class BinkIDCTTestSuite : public CxxTest::TestSuite {
+	typedef Video::BinkDecoder::BinkVideoTrack Track;
+
+	enum {
+		kBlocks = 2000,
+		kPitch = 24 // Wider than a block, to check the stores stay inside it
+	};
+
+	uint32 _seed;
+
+	int32 nextCoeff(int range) {
+		_seed = _seed * 1103515245 + 12345;
+		return (int32)((_seed >> 8) % (2 * range + 1)) - range;
+	}
+
+	void fillBlock(int32 *block, int n) {
+		// Mix dense blocks, sparse ones like real inter blocks and
+		// blocks with large coefficients that wrap around when stored
+		const int range = (n % 3 == 0) ? 0x7FFF : 2048;
+		const bool sparse = (n % 3 == 1);
+
+		for (int i = 0; i < 64; i++) {
+			if (sparse && i != 0 && (nextCoeff(7) != 0))
+				block[i] = 0;
+			else
+				block[i] = nextCoeff(range);
+		}
+	}
+
+	void fillDest(byte *dest) {
+		for (int i = 0; i < kPitch * 8; i++) {
+			_seed = _seed * 1103515245 + 12345;
+			dest[i] = _seed >> 24;
+		}
+	}
+
+public:
+	void test_sse2_matches_scalar() {
+		bool simd = false;
+#ifdef SCUMMVM_SSE2
+		simd = instrset_detect() >= 2;
+#endif
+		if (!simd)
+			return;
+
+#ifdef SCUMMVM_SSE2
+		_seed = 12345;
+
+		for (int n = 0; n < kBlocks; n++) {
+			int32 block[64], reference[64], result[64];
+			fillBlock(block, n);
+
+			// IDCT
+			memcpy(reference, block, sizeof(block));
+			memcpy(result, block, sizeof(block));
+			Track::IDCTScalar(reference);
+			Track::IDCTSSE2(result);
+			for (int i = 0; i < 64; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("IDCT block %d, coefficient %d", n, i).c_str(), result[i], reference[i]);
+
+			// IDCTPut
+			byte refDest[kPitch * 8], resDest[kPitch * 8];
+			fillDest(refDest);
+			memcpy(resDest, refDest, sizeof(refDest));
+			Track::IDCTPutScalar(refDest, kPitch, block);
+			Track::IDCTPutSSE2(resDest, kPitch, block);
+			for (int i = 0; i < kPitch * 8; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("IDCTPut block %d, byte %d", n, i).c_str(), resDest[i], refDest[i]);
+
+			// IDCTAdd, the scalar version transforms the block in place
+			fillDest(refDest);
+			memcpy(resDest, refDest, sizeof(refDest));
+			memcpy(reference, block, sizeof(block));
+			Track::IDCTAddScalar(refDest, kPitch, reference);
+			Track::IDCTAddSSE2(resDest, kPitch, block);
+			for (int i = 0; i < kPitch * 8; i++)
+				TSM_ASSERT_EQUALS(Common::String::format("IDCTAdd block %d, byte %d", n, i).c_str(), resDest[i], refDest[i]);
+		}
+#endif
+	}
+};
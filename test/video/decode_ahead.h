@@ -0,0 +1,231 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/stream.h"
+
+#include "graphics/surface.h"
+
+#include "video/video_decoder.h"
+
+#include "../null_osystem.h"
+
+namespace {
+
+class SyntheticDecoder : public Video::VideoDecoder {
+public:
+	/**
+	 * A video track whose frames are filled with their frame number. Frames are
+	 * ten seconds apart, so the tests never run into the next frame being due.
+	 */
+	class SyntheticVideoTrack : public FixedRateVideoTrack {
+	public:
+		SyntheticVideoTrack(int frameCount) : _frameCount(frameCount), _curFrame(-1), _reversed(false), _decodeCount(0) {
+			_surface.create(4, 4, Graphics::PixelFormat::createFormatCLUT8());
+		}
+
+		~SyntheticVideoTrack() {
+			_surface.free();
+		}
+
+		uint16 getWidth() const override { return _surface.w; }
+		uint16 getHeight() const override { return _surface.h; }
+		Graphics::PixelFormat getPixelFormat() const override { return _surface.format; }
+		int getCurFrame() const override { return _curFrame; }
+		int getFrameCount() const override { return _frameCount; }
+
+		bool endOfTrack() const override {
+			if (_reversed)
+				return _curFrame < 0;
+
+			return _curFrame >= _frameCount - 1;
+		}
+
+		const Graphics::Surface *decodeNextFrame() override {
+			if (_reversed)
+				_curFrame--;
+			else
+				_curFrame++;
+
+			_surface.fillRect(Common::Rect(_surface.w, _surface.h), _curFrame);
+			_decodeCount++;
+			return &_surface;
+		}
+
+		bool isSeekable() const override { return true; }
+
+		bool seek(const Audio::Timestamp &time) override {
+			_curFrame = (int)getFrameAtTime(time) - 1;
+			return true;
+		}
+
+		bool setReverse(bool reverse) override {
+			_reversed = reverse;
+			return true;
+		}
+
+		bool isReversed() const override { return _reversed; }
+
+		int getDecodeCount() const { return _decodeCount; }
+
+	protected:
+		Common::Rational getFrameRate() const override { return Common::Rational(1, 10); }
+
+	private:
+		Graphics::Surface _surface;
+		int _frameCount;
+		int _curFrame;
+		bool _reversed;
+		int _decodeCount;
+	};
+
+	SyntheticDecoder(int frameCount) {
+		_track = new SyntheticVideoTrack(frameCount);
+		addTrack(_track);
+	}
+
+	bool loadStream(Common::SeekableReadStream *stream) override {
+		delete stream;
+		return false;
+	}
+
+	SyntheticVideoTrack *_track;
+};
+
+} // End of anonymous namespace
+
+class DecodeAheadTestSuite : public CxxTest::TestSuite {
+	int nextFrame(SyntheticDecoder &decoder) {
+		const Graphics::Surface *surface = decoder.decodeNextFrame();
+		if (!surface)
+			return -1;
+
+		return *(const byte *)surface->getBasePtr(surface->w - 1, surface->h - 1);
+	}
+
+public:
+	void test_queue_order() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		SyntheticDecoder decoder(20);
+		decoder.setDecodeAhead(3);
+		decoder.start();
+
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(decoder._track->getDecodeCount(), 4);
+		TS_ASSERT_EQUALS(decoder._track->getCurFrame(), 3);
+		TS_ASSERT_EQUALS(decoder.getCurFrame(), 0);
+
+		// Dequeuing does not decode, and each frame keeps its own contents
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 2);
+		TS_ASSERT_EQUALS(decoder._track->getDecodeCount(), 4);
+		TS_ASSERT_EQUALS(decoder.getCurFrame(), 2);
+
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(decoder._track->getCurFrame(), 5);
+		for (int i = 3; i < 6; i++)
+			TS_ASSERT_EQUALS(nextFrame(decoder), i);
+
+		// Frames are decoded on demand again once the queue is empty
+		TS_ASSERT_EQUALS(nextFrame(decoder), 6);
+		TS_ASSERT_EQUALS(decoder._track->getDecodeCount(), 7);
+#endif
+	}
+
+	void test_seek_flushes() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		SyntheticDecoder decoder(20);
+		decoder.setDecodeAhead(3);
+		decoder.start();
+
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		decoder.decodeAhead();
+
+		TS_ASSERT(decoder.seekToFrame(10));
+		TS_ASSERT_EQUALS(decoder.getCurFrame(), 9);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 10);
+
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(decoder._track->getCurFrame(), 13);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 11);
+#endif
+	}
+
+	void test_rewind_flushes() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		SyntheticDecoder decoder(20);
+		decoder.setDecodeAhead(3);
+		decoder.start();
+
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+
+		TS_ASSERT(decoder.rewind());
+		TS_ASSERT_EQUALS(decoder.getCurFrame(), -1);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+#endif
+	}
+
+	void test_reverse_flushes() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		SyntheticDecoder decoder(20);
+		decoder.setDecodeAhead(3);
+		decoder.start();
+
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 2);
+
+		// The track is moved back to the frame on screen
+		TS_ASSERT(decoder.setReverse(true));
+		TS_ASSERT_EQUALS(decoder._track->getCurFrame(), 2);
+		TS_ASSERT_EQUALS(decoder.getCurFrame(), 2);
+
+		// Nothing is decoded ahead while playing backwards
+		int decodeCount = decoder._track->getDecodeCount();
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(decoder._track->getDecodeCount(), decodeCount);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+#endif
+	}
+
+	void test_end_time() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		SyntheticDecoder decoder(20);
+		decoder.setDecodeAhead(3);
+		decoder.start();
+
+		TS_ASSERT_EQUALS(nextFrame(decoder), 0);
+		decoder.decodeAhead();
+
+		// Frames 2 and 3 were queued before the end time was set
+		decoder.setEndTime(Audio::Timestamp(20000, 1000));
+		TS_ASSERT(!decoder.endOfVideo());
+		TS_ASSERT_EQUALS(nextFrame(decoder), 1);
+		TS_ASSERT(decoder.endOfVideo());
+
+		// Nothing is decoded past the end time either
+		decoder.setEndTime(Audio::Timestamp(50000, 1000));
+		int decodeCount = decoder._track->getDecodeCount();
+		TS_ASSERT(!decoder.endOfVideo());
+		TS_ASSERT_EQUALS(nextFrame(decoder), 2);
+		TS_ASSERT_EQUALS(nextFrame(decoder), 3);
+		decoder.decodeAhead();
+		TS_ASSERT_EQUALS(nextFrame(decoder), 4);
+		TS_ASSERT(decoder.endOfVideo());
+		TS_ASSERT_EQUALS(decoder._track->getDecodeCount(), decodeCount + 1);
+#endif
+	}
+};
@@ -0,0 +1,422 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "common/endian.h"
+#include "common/memstream.h"
+
+#include "graphics/surface.h"
+
+#include "video/smk_decoder.h"
+
+/**
+ * Builds a small Smacker (SMK4) video without audio, and draws the frames it
+ * describes into reference surfaces, one pixel at a time.
+ *
+ * All Huffman trees are lopsided, so their codes range from a single bit to
+ * more than the 10 bits the decoder resolves with its prefix tables.
+ */
+class SmackerStreamBuilder {
+public:
+	enum {
+		kWidth = 16,
+		kHeight = 16,
+		kBlocksPerRow = kWidth / 4,
+		kBlocks = kBlocksPerRow * kHeight / 4
+	};
+
+	SmackerStreamBuilder() {
+		for (int i = 0; i < 4; i++) {
+			// Unused values first, so the values in use get the longest codes
+			for (uint j = 0; j < 8; j++)
+				_values[i].push_back(0x7F00 + j);
+		}
+	}
+
+	~SmackerStreamBuilder() {
+		for (uint i = 0; i < _reference.size(); i++) {
+			_reference[i]->free();
+			delete _reference[i];
+		}
+	}
+
+	void beginFrame() {
+		Graphics::Surface *surface = new Graphics::Surface();
+		surface->create(kWidth, kHeight, Graphics::PixelFormat::createFormatCLUT8());
+		if (_reference.empty())
+			memset(surface->getPixels(), 0, kWidth * kHeight);
+		else
+			surface->copyFrom(*_reference.back());
+
+		_reference.push_back(surface);
+		_frames.push_back(Common::Array<Symbol>());
+		_block = 0;
+	}
+
+	void skip(uint count) {
+		addSymbol(kTreeType, kBlockSkip | ((count - 1) << 2));
+		_block += count;
+	}
+
+	void fill(uint count, byte color) {
+		addSymbol(kTreeType, kBlockFill | ((count - 1) << 2) | (color << 8));
+		for (uint i = 0; i < count; i++, _block++) {
+			for (int y = 0; y < 4; y++)
+				for (int x = 0; x < 4; x++)
+					setPixel(x, y, color);
+		}
+	}
+
+	void mono(byte lo, byte hi, uint16 map) {
+		addSymbol(kTreeType, kBlockMono);
+		addSymbol(kTreeMClr, (hi << 8) | lo);
+		addSymbol(kTreeMMap, map);
+		for (int y = 0; y < 4; y++)
+			for (int x = 0; x < 4; x++)
+				setPixel(x, y, (map & (1 << (y * 4 + x))) ? hi : lo);
+		_block++;
+	}
+
+	/** A full block with four rows of four separate pixels. */
+	void full(const byte pixels[16]) {
+		addSymbol(kTreeType, kBlockFull);
+		addBits(0, 2);
+		for (int y = 0; y < 4; y++) {
+			const byte *row = pixels + y * 4;
+			addSymbol(kTreeFull, row[2] | (row[3] << 8));
+			addSymbol(kTreeFull, row[0] | (row[1] << 8));
+			for (int x = 0; x < 4; x++)
+				setPixel(x, y, row[x]);
+		}
+		_block++;
+	}
+
+	/** A full block of 2x2 pixel squares, @p pixels holds the top left one of each. */
+	void fullDouble(const byte pixels[4]) {
+		addSymbol(kTreeType, kBlockFull);
+		addBits(1, 1);
+		addSymbol(kTreeFull, pixels[0] | (pixels[1] << 8));
+		addSymbol(kTreeFull, pixels[2] | (pixels[3] << 8));
+		for (int y = 0; y < 4; y++)
+			for (int x = 0; x < 4; x++)
+				setPixel(x, y, pixels[(y / 2) * 2 + x / 2]);
+		_block++;
+	}
+
+	/** A full block of two rows of four pixels, each shown twice. */
+	void fullHalf(const byte pixels[8]) {
+		addSymbol(kTreeType, kBlockFull);
+		addBits(2, 2);
+		for (int i = 0; i < 2; i++) {
+			const byte *row = pixels + i * 4;
+			addSymbol(kTreeFull, row[2] | (row[3] << 8));
+			addSymbol(kTreeFull, row[0] | (row[1] << 8));
+			for (int x = 0; x < 4; x++) {
+				setPixel(x, i * 2, row[x]);
+				setPixel(x, i * 2 + 1, row[x]);
+			}
+		}
+		_block++;
+	}
+
+	const Graphics::Surface &getReference(uint frame) const { return *_reference[frame]; }
+
+	/** Create the video. The caller owns the returned stream. */
+	Common::SeekableReadStream *createStream() {
+		BitWriter trees;
+		for (int i = 0; i < 4; i++)
+			writeTree(trees, kTreeOrder[i]);
+
+		Common::Array<BitWriter> frames;
+		frames.resize(_frames.size());
+		for (uint i = 0; i < _frames.size(); i++) {
+			for (uint j = 0; j < _frames[i].size(); j++) {
+				const Symbol &symbol = _frames[i][j];
+				if (symbol.tree == kTreeBits)
+					frames[i].putBits(symbol.value, symbol.size);
+				else
+					writeCode(frames[i], symbol.tree, symbol.value);
+			}
+			// Frame sizes are multiples of 4 bytes
+			while (frames[i].getData().size() & 3)
+				frames[i].putBits(0, 8);
+		}
+
+		Common::MemoryWriteStreamDynamic stream(DisposeAfterUse::NO);
+		stream.writeUint32BE(MKTAG('S', 'M', 'K', '4'));
+		stream.writeUint32LE(kWidth);
+		stream.writeUint32LE(kHeight);
+		stream.writeUint32LE(_frames.size());
+		stream.writeSint32LE(100); // Frame delay in ms
+		stream.writeUint32LE(0);   // Flags
+		for (int i = 0; i < 7; i++)
+			stream.writeUint32LE(0); // Largest audio chunk sizes
+		stream.writeUint32LE(trees.getData().size());
+		for (int i = 0; i < 4; i++)
+			stream.writeUint32LE(kTreeAllocSize);
+		for (int i = 0; i < 7; i++)
+			stream.writeUint32LE(0); // Audio formats
+		stream.writeUint32LE(0);
+		for (uint i = 0; i < frames.size(); i++)
+			stream.writeUint32LE(frames[i].getData().size());
+		for (uint i = 0; i < frames.size(); i++)
+			stream.writeByte(0); // Frame types, neither palette nor audio
+		stream.write(trees.getData().begin(), trees.getData().size());
+		for (uint i = 0; i < frames.size(); i++)
+			stream.write(frames[i].getData().begin(), frames[i].getData().size());
+
+		return new Common::MemoryReadStream(stream.getData(), stream.size(), DisposeAfterUse::YES);
+	}
+
+private:
+	enum {
+		kBlockMono = 0,
+		kBlockFull = 1,
+		kBlockSkip = 2,
+		kBlockFill = 3
+	};
+
+	enum Tree {
+		kTreeMMap = 0,
+		kTreeMClr = 1,
+		kTreeFull = 2,
+		kTreeType = 3,
+		kTreeBits = 4 // Raw bits instead of a code
+	};
+
+	static const Tree kTreeOrder[4];
+	static const uint32 kTreeAllocSize = 4096;
+
+	/** Writes the least significant bits first, like SmackerBitStream reads them. */
+	class BitWriter {
+	public:
+		BitWriter() : _bits(0) {}
+
+		void putBits(uint32 value, int count) {
+			for (int i = 0; i < count; i++, _bits++) {
+				if (!(_bits & 7))
+					_data.push_back(0);
+				if (value & (1u << i))
+					_data.back() |= 1 << (_bits & 7);
+			}
+		}
+
+		const Common::Array<byte> &getData() const { return _data; }
+
+	private:
+		Common::Array<byte> _data;
+		uint _bits;
+	};
+
+	struct Symbol {
+		Tree tree;
+		uint32 value;
+		int size;
+	};
+
+	Common::Array<Graphics::Surface *> _reference;
+	Common::Array<Common::Array<Symbol> > _frames;
+	Common::Array<uint16> _values[4];
+	uint _block;
+
+	void setPixel(int x, int y, byte color) {
+		*(byte *)_reference.back()->getBasePtr((_block % kBlocksPerRow) * 4 + x, (_block / kBlocksPerRow) * 4 + y) = color;
+	}
+
+	void addSymbol(Tree tree, uint16 value) {
+		Symbol symbol = { tree, value, 0 };
+		_frames.back().push_back(symbol);
+
+		for (uint i = 0; i < _values[tree].size(); i++)
+			if (_values[tree][i] == value)
+				return;
+		_values[tree].push_back(value);
+	}
+
+	void addBits(uint32 value, int size) {
+		Symbol symbol = { kTreeBits, value, size };
+		_frames.back().push_back(symbol);
+	}
+
+	/**
+	 * A tree for the low or high bytes of the values, where the code of each
+	 * byte is the byte itself.
+	 */
+	static void writeByteTree(BitWriter &bits, uint32 prefix, int length) {
+		if (length == 8) {
+			bits.putBits(0, 1);
+			bits.putBits(prefix, 8);
+			return;
+		}
+
+		bits.putBits(1, 1);
+		writeByteTree(bits, prefix, length + 1);
+		writeByteTree(bits, prefix | (1 << length), length + 1);
+	}
+
+	/**
+	 * Write a tree where the code of the n-th value is n set bits followed
+	 * by a clear one, and the last value has no clear bit.
+	 */
+	void writeTree(BitWriter &bits, Tree tree) {
+		const Common::Array<uint16> &values = _values[tree];
+
+		bits.putBits(1, 1);
+		for (int i = 0; i < 2; i++) {
+			bits.putBits(1, 1);
+			writeByteTree(bits, 0, 0);
+			bits.putBits(0, 1);
+		}
+
+		// Escape markers, none of them is used
+		for (int i = 0; i < 3; i++)
+			bits.putBits(0xFFFD + i, 16);
+
+		for (uint i = 0; i < values.size(); i++) {
+			if (i != values.size() - 1)
+				bits.putBits(1, 1);
+			bits.putBits(0, 1);
+			bits.putBits(values[i] & 0xFF, 8);
+			bits.putBits(values[i] >> 8, 8);
+		}
+		bits.putBits(0, 1);
+	}
+
+	void writeCode(BitWriter &bits, Tree tree, uint16 value) {
+		const Common::Array<uint16> &values = _values[tree];
+
+		for (uint i = 0; i < values.size(); i++) {
+			if (values[i] == value) {
+				if (i != 0)
+					bits.putBits(0xFFFFFFFF, i);
+				if (i != values.size() - 1)
+					bits.putBits(0, 1);
+				return;
+			}
+		}
+	}
+};
+
+const SmackerStreamBuilder::Tree SmackerStreamBuilder::kTreeOrder[4] = {
+	kTreeMMap, kTreeMClr, kTreeFull, kTreeType
+};
+
+class SmackerTestSuite : public CxxTest::TestSuite {
+	void buildVideo(SmackerStreamBuilder &builder) {
+		static const byte fullPixels[16] = {
+			0x10, 0x11, 0x12, 0x13,
+			0x20, 0x21, 0x22, 0x23,
+			0x30, 0x31, 0x32, 0x33,
+			0x40, 0x41, 0x42, 0xFF
+		};
+		static const byte doublePixels[4] = { 0x51, 0x52, 0x53, 0x54 };
+		static const byte halfPixels[8] = {
+			0x61, 0x62, 0x63, 0x64,
+			0x71, 0x72, 0x73, 0x74
+		};
+
+		// Every kind of block
+		builder.beginFrame();
+		builder.fill(4, 5);
+		builder.mono(0x80, 0x81, 0x8421);
+		builder.mono(0xFE, 0x01, 0xF00F);
+		builder.full(fullPixels);
+		builder.fullDouble(doublePixels);
+		builder.fullHalf(halfPixels);
+		builder.fill(7, 9);
+
+		// Two separate changes
+		builder.beginFrame();
+		builder.skip(5);
+		builder.mono(0x33, 0x44, 0x1234);
+		builder.skip(4);
+		builder.fill(1, 200);
+		builder.skip(5);
+
+		// No changes at all
+		builder.beginFrame();
+		builder.skip(16);
+
+		// A change spanning several rows of blocks
+		builder.beginFrame();
+		builder.skip(1);
+		builder.fill(2, 7);
+		builder.skip(2);
+		builder.fill(2, 8);
+		builder.skip(9);
+	}
+
+	static uint countDifferences(const Graphics::Surface &a, const Graphics::Surface &b, int x, int y) {
+		uint differences = 0;
+		for (int i = 0; i < a.h; i++)
+			differences += memcmp(a.getBasePtr(0, i), b.getBasePtr(x, y + i), a.w) != 0;
+
+		return differences;
+	}
+
+public:
+	void test_decode_blocks() {
+		SmackerStreamBuilder builder;
+		buildVideo(builder);
+
+		Video::SmackerDecoder decoder;
+		TS_ASSERT(decoder.loadStream(builder.createStream()));
+		TS_ASSERT_EQUALS(decoder.getWidth(), SmackerStreamBuilder::kWidth);
+		TS_ASSERT_EQUALS(decoder.getHeight(), SmackerStreamBuilder::kHeight);
+		TS_ASSERT_EQUALS(decoder.getFrameCount(), 4u);
+
+		for (uint i = 0; i < decoder.getFrameCount(); i++) {
+			const Graphics::Surface *frame = decoder.decodeNextFrame();
+			TS_ASSERT(frame);
+			if (!frame)
+				break;
+			TSM_ASSERT_EQUALS(Common::String::format("frame %u", i).c_str(), countDifferences(builder.getReference(i), *frame, 0, 0), 0u);
+		}
+
+		TS_ASSERT(decoder.endOfVideo());
+	}
+
+	void test_decode_into() {
+		SmackerStreamBuilder builder;
+		buildVideo(builder);
+
+		Video::SmackerDecoder direct, reference;
+		TS_ASSERT(direct.loadStream(builder.createStream()));
+		TS_ASSERT(reference.loadStream(builder.createStream()));
+
+		Graphics::Surface screen, expected;
+		screen.create(24, 20, Graphics::PixelFormat::createFormatCLUT8());
+		expected.create(24, 20, Graphics::PixelFormat::createFormatCLUT8());
+		memset(screen.getPixels(), 0xEE, screen.h * screen.pitch);
+		memset(expected.getPixels(), 0xEE, expected.h * expected.pitch);
+
+		// The area of the frames that changed, the first one is drawn in full
+		static const int changedArea[4] = { 256, 32, 0, 64 };
+
+		for (uint i = 0; i < 4; i++) {
+			Common::List<Common::Rect> changed;
+			TS_ASSERT(direct.decodeNextFrameInto(screen, 3, 2, &changed));
+
+			const Graphics::Surface *frame = reference.decodeNextFrame();
+			TS_ASSERT(frame);
+			if (!frame)
+				break;
+			expected.copyRectToSurface(*frame, 3, 2, Common::Rect(frame->w, frame->h));
+
+			TSM_ASSERT_EQUALS(Common::String::format("frame %u", i).c_str(), countDifferences(expected, screen, 0, 0), 0u);
+
+			int area = 0;
+			for (Common::List<Common::Rect>::const_iterator it = changed.begin(); it != changed.end(); ++it)
+				area += it->width() * it->height();
+			TSM_ASSERT_EQUALS(Common::String::format("frame %u", i).c_str(), area, changedArea[i]);
+
+			// Drawing does not use up the rects of getNextDirtyRect()
+			int dirtyArea = 0;
+			while (const Common::Rect *rect = direct.getNextDirtyRect())
+				dirtyArea += rect->width() * rect->height();
+			TSM_ASSERT_EQUALS(Common::String::format("frame %u", i).c_str(), dirtyArea, i ? changedArea[i] : 256);
+		}
+
+		screen.free();
+		expected.free();
+	}
+};
@@ -507,7 +507,7 @@ void AVIDecoder::close() {
 	_movieListStart = 0;
 	_movieListEnd = 0;
 
-	_indexEntries.clear();
+	_indexEntries.clearAll();
 	memset(&_header, 0, sizeof(_header));
 
 	_videoTracks.clear();
@@ -698,54 +698,40 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	// Reset any palette, if necessary
 	videoTrack->useInitialPalette();
 
-	int lastKeyFrame = -1;
-	int frameIndex = -1;
-	uint curFrame = 0;
-
-	// Go through and figure out where we should be
-	// If there's a palette, we need to find the palette too
-	for (uint32 i = 0; i < _indexEntries.size(); i++) {
-		const OldIndex &index = _indexEntries[i];
-
-		// We don't care about RECs
-		if (index.id == ID_REC)
-			continue;
-
-		// We're only looking at entries for this track
-		if (getStreamIndex(index.id) != videoIndex)
-			continue;
+	// Figure out where we should be from the per-stream index
+	const IndexEntries::StreamIndex *videoStream = _indexEntries.getStream(videoIndex);
+	if (!videoStream || frame >= videoStream->frames.size()) // This shouldn't happen.
+		return false;
 
-		uint16 streamType = getStreamType(index.id);
+	uint32 frameIndex = videoStream->frames[frame];
 
-		if (streamType == kStreamTypePaletteChange) {
-			// We need to handle any palette change we see since there's no
-			// flag to tell if this is a "key" palette.
-			// Decode the palette
-			_fileStream->seek(_indexEntries[i].offset + 8);
-			Common::SeekableReadStream *chunk = 0;
+	// We need to handle any palette change before the frame since there's
+	// no flag to tell if this is a "key" palette.
+	for (uint32 i = 0; i < videoStream->palettes.size() && videoStream->palettes[i] < frameIndex; i++) {
+		const OldIndex &index = _indexEntries[videoStream->palettes[i]];
 
-			if (_indexEntries[i].size != 0)
-				chunk = _fileStream->readStream(_indexEntries[i].size);
+		// Decode the palette
+		_fileStream->seek(index.offset + 8);
+		Common::SeekableReadStream *chunk = 0;
 
-			videoTrack->loadPaletteFromChunk(chunk);
-		} else {
-			// Check to see if this is a keyframe
-			// The first frame has to be a keyframe
-			if ((_indexEntries[i].flags & AVIIF_INDEX) || curFrame == 0)
-				lastKeyFrame = i;
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
-			// Did we find the target frame?
-			if (frame == curFrame) {
-				frameIndex = i;
-				break;
-			}
+		videoTrack->loadPaletteFromChunk(chunk);
+	}
 
-			curFrame++;
-		}
+	// Find the last keyframe at or before the frame. The first frame is
+	// always in the list, so there is one.
+	uint32 low = 0, high = videoStream->keyFrames.size();
+	while (low < high) {
+		uint32 mid = (low + high) / 2;
+		if (videoStream->keyFrames[mid] <= frame)
+			low = mid + 1;
+		else
+			high = mid;
 	}
 
-	if (frameIndex < 0) // This shouldn't happen.
-		return false;
+	uint32 lastKeyFrame = videoStream->keyFrames[low - 1];
 
 	// Update all the audio tracks
 	for (uint32 i = 0; i < _audioTracks.size(); i++) {
@@ -757,25 +743,15 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		// Set the chunk index for the track
 		audioTrack->setCurChunk(frame);
 
-		uint32 chunksFound = 0;
-		for (uint32 j = 0; j < _indexEntries.size(); j++) {
+		const IndexEntries::StreamIndex *audioStream = _indexEntries.getStream(_audioTracks[i].index);
+		if (audioStream && frame < audioStream->chunks.size()) {
+			uint32 j = audioStream->chunks[frame];
 			const OldIndex &index = _indexEntries[j];
 
-			// Continue ignoring RECs
-			if (index.id == ID_REC)
-				continue;
-
-			if (getStreamIndex(index.id) == _audioTracks[i].index) {
-				if (chunksFound == frame) {
-					_fileStream->seek(index.offset + 8);
-					Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
-					audioTrack->queueSound(audioChunk);
-					_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
-					break;
-				}
-
-				chunksFound++;
-			}
+			_fileStream->seek(index.offset + 8);
+			Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
+			audioTrack->queueSound(audioChunk);
+			_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
 		}
 
 		// Skip any audio to bring us to the right time
@@ -783,25 +759,15 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	}
 
 	// Decode from keyFrame to curFrame - 1
-	for (int i = lastKeyFrame; i < frameIndex; i++) {
-		if (_indexEntries[i].id == ID_REC)
-			continue;
-
-		if (getStreamIndex(_indexEntries[i].id) != videoIndex)
-			continue;
-
-		uint16 streamType = getStreamType(_indexEntries[i].id);
-
-		// Ignore palettes, they were already handled
-		if (streamType == kStreamTypePaletteChange)
-			continue;
+	for (uint32 i = lastKeyFrame; i < frame; i++) {
+		const OldIndex &index = _indexEntries[videoStream->frames[i]];
 
 		// Frame, hopefully
-		_fileStream->seek(_indexEntries[i].offset + 8);
+		_fileStream->seek(index.offset + 8);
 		Common::SeekableReadStream *chunk = 0;
 
-		if (_indexEntries[i].size != 0)
-			chunk = _fileStream->readStream(_indexEntries[i].size);
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
 		videoTrack->decodeFrame(chunk);
 	}
@@ -904,6 +870,8 @@ void AVIDecoder::readOldIndex(uint32 size) {
 		_indexEntries.push_back(indexEntry);
 		debug(7, "Index %d: Tag '%s', Offset = %d, Size = %d (Flags = %d)", i, tag2str(indexEntry.id), indexEntry.offset, indexEntry.size, indexEntry.flags);
 	}
+
+	_indexEntries.buildStreamIndex();
 }
 
 void AVIDecoder::checkTruemotion1() {
@@ -1218,15 +1186,49 @@ AVIDecoder::TrackStatus::TrackStatus() : track(0), chunkSearchOffset(0) {
 }
 
 AVIDecoder::OldIndex *AVIDecoder::IndexEntries::find(uint index, uint frameNumber) {
-	for (uint idx = 0, frameCtr = 0; idx < size(); ++idx) {
-		if ((*this)[idx].id != ID_REC &&
-				AVIDecoder::getStreamIndex((*this)[idx].id) == index) {
-			if (frameCtr++ == frameNumber)
-				return &(*this)[idx];
+	const StreamIndex *stream = getStream(index);
+	if (!stream || frameNumber >= stream->chunks.size())
+		return nullptr;
+
+	return &(*this)[stream->chunks[frameNumber]];
+}
+
+const AVIDecoder::IndexEntries::StreamIndex *AVIDecoder::IndexEntries::getStream(uint index) const {
+	return (index < _streams.size()) ? &_streams[index] : nullptr;
+}
+
+void AVIDecoder::IndexEntries::buildStreamIndex() {
+	_streams.clear();
+
+	for (uint idx = 0; idx < size(); ++idx) {
+		const OldIndex &entry = (*this)[idx];
+
+		// We don't care about RECs
+		if (entry.id == ID_REC)
+			continue;
+
+		uint streamIndex = AVIDecoder::getStreamIndex(entry.id);
+		if (streamIndex >= _streams.size())
+			_streams.resize(streamIndex + 1);
+
+		StreamIndex &stream = _streams[streamIndex];
+		stream.chunks.push_back(idx);
+
+		if (AVIDecoder::getStreamType(entry.id) == kStreamTypePaletteChange) {
+			stream.palettes.push_back(idx);
+		} else {
+			// The first frame has to be a keyframe
+			if ((entry.flags & AVIIF_INDEX) || stream.frames.empty())
+				stream.keyFrames.push_back(stream.frames.size());
+
+			stream.frames.push_back(idx);
 		}
 	}
+}
 
-	return nullptr;
+void AVIDecoder::IndexEntries::clearAll() {
+	Common::Array<OldIndex>::clear();
+	_streams.clear();
 }
 
 } // End of namespace Video
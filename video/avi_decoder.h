@@ -319,7 +319,25 @@ protected:
 
 	class IndexEntries : public Common::Array<OldIndex> {
 	public:
+		/** Positions of the entries belonging to one stream */
+		struct StreamIndex {
+			Common::Array<uint32> chunks;    ///< All chunks of the stream
+			Common::Array<uint32> frames;    ///< Chunks other than palette changes
+			Common::Array<uint32> palettes;  ///< Palette change chunks
+			Common::Array<uint32> keyFrames; ///< Numbers of the frames that are keyframes
+		};
+
 		OldIndex *find(uint index, uint frameNumber);
+		const StreamIndex *getStream(uint index) const;
+
+		/** Build the per-stream lookup tables once all entries were added. */
+		void buildStreamIndex();
+
+		/** Remove the entries together with the per-stream lookup tables. */
+		void clearAll();
+
+	private:
+		Common::Array<StreamIndex> _streams;
 	};
 
 	AVIHeader _header;
@@ -345,7 +363,7 @@ protected:
 	void handleStreamHeader(uint32 size);
 	void readStreamName(uint32 size);
 	void readPalette8(uint32 size);
-	uint16 getStreamType(uint32 tag) const { return tag & 0xFFFF; }
+	static uint16 getStreamType(uint32 tag) { return tag & 0xFFFF; }
 	static byte getStreamIndex(uint32 tag);
 	void checkTruemotion1();
 	uint getVideoTrackOffset(uint trackIndex, uint frameNumber = 0);
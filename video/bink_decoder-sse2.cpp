@@ -0,0 +1,192 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#include "video/bink_decoder.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Video {
+
+// This is the IDCT from bink_decoder.cpp working on four columns (or rows)
+// at a time. All intermediate values are kept as 32-bit integers, so the
+// output is identical to the one of the scalar code.
+
+static FORCEINLINE __m128i mulConst(__m128i a, int32 c) {
+	// SSE2 lacks a 32-bit multiplication keeping the low half, so build
+	// one out of two unsigned 32x32->64 multiplications. The low 32 bits
+	// of the product are the same for signed and unsigned values.
+	const __m128i k = _mm_set1_epi32(c);
+	__m128i even = _mm_mul_epu32(a, k);
+	__m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), k);
+	return _mm_srai_epi32(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                                         _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0))), 11);
+}
+
+static FORCEINLINE void transform(__m128i *d, const __m128i *s) {
+	const __m128i a0 = _mm_add_epi32(s[0], s[4]);
+	const __m128i a1 = _mm_sub_epi32(s[0], s[4]);
+	const __m128i a2 = _mm_add_epi32(s[2], s[6]);
+	const __m128i a3 = mulConst(_mm_sub_epi32(s[2], s[6]), 2896);
+	const __m128i a4 = _mm_add_epi32(s[5], s[3]);
+	const __m128i a5 = _mm_sub_epi32(s[5], s[3]);
+	const __m128i a6 = _mm_add_epi32(s[1], s[7]);
+	const __m128i a7 = _mm_sub_epi32(s[1], s[7]);
+	const __m128i b0 = _mm_add_epi32(a4, a6);
+	const __m128i b1 = mulConst(_mm_add_epi32(a5, a7), 3784);
+	const __m128i b2 = _mm_add_epi32(_mm_sub_epi32(mulConst(a5, -5352), b0), b1);
+	const __m128i b3 = _mm_sub_epi32(mulConst(_mm_sub_epi32(a6, a4), 2896), b2);
+	const __m128i b4 = _mm_sub_epi32(_mm_add_epi32(mulConst(a7, 2217), b3), b1);
+
+	const __m128i e0 = _mm_add_epi32(a0, a2);
+	const __m128i e1 = _mm_sub_epi32(_mm_add_epi32(a1, a3), a2);
+	const __m128i e2 = _mm_add_epi32(_mm_sub_epi32(a1, a3), a2);
+	const __m128i e3 = _mm_sub_epi32(a0, a2);
+
+	d[0] = _mm_add_epi32(e0, b0);
+	d[1] = _mm_add_epi32(e1, b2);
+	d[2] = _mm_add_epi32(e2, b3);
+	d[3] = _mm_sub_epi32(e3, b4);
+	d[4] = _mm_add_epi32(e3, b4);
+	d[5] = _mm_sub_epi32(e2, b3);
+	d[6] = _mm_sub_epi32(e1, b2);
+	d[7] = _mm_sub_epi32(e0, b0);
+}
+
+static FORCEINLINE void transpose4(__m128i *d, const __m128i *s) {
+	const __m128i t0 = _mm_unpacklo_epi32(s[0], s[1]);
+	const __m128i t1 = _mm_unpacklo_epi32(s[2], s[3]);
+	const __m128i t2 = _mm_unpackhi_epi32(s[0], s[1]);
+	const __m128i t3 = _mm_unpackhi_epi32(s[2], s[3]);
+
+	d[0] = _mm_unpacklo_epi64(t0, t1);
+	d[1] = _mm_unpackhi_epi64(t0, t1);
+	d[2] = _mm_unpacklo_epi64(t2, t3);
+	d[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+/**
+ * Run the full IDCT on an 8x8 block. Row i of the result ends up in
+ * out[i * 2] (columns 0 to 3) and out[i * 2 + 1] (columns 4 to 7).
+ */
+static void idct(__m128i *out, const int32 *block) {
+	__m128i src[8], colLeft[8], colRight[8];
+
+	// Columns, four at a time
+	for (int i = 0; i < 8; i++)
+		src[i] = _mm_loadu_si128((const __m128i *)(block + i * 8));
+	transform(colLeft, src);
+
+	for (int i = 0; i < 8; i++)
+		src[i] = _mm_loadu_si128((const __m128i *)(block + i * 8 + 4));
+	transform(colRight, src);
+
+	// Rows, four at a time, on the transposed column results
+	const __m128i round = _mm_set1_epi32(0x7F);
+	for (int half = 0; half < 2; half++) {
+		__m128i rows[8];
+
+		transpose4(src,     colLeft  + half * 4);
+		transpose4(src + 4, colRight + half * 4);
+		transform(rows, src);
+
+		for (int i = 0; i < 8; i++)
+			rows[i] = _mm_srai_epi32(_mm_add_epi32(rows[i], round), 8);
+
+		__m128i left[4], right[4];
+		transpose4(left,  rows);
+		transpose4(right, rows + 4);
+
+		for (int i = 0; i < 4; i++) {
+			out[(half * 4 + i) * 2 + 0] = left[i];
+			out[(half * 4 + i) * 2 + 1] = right[i];
+		}
+	}
+}
+
+/** Truncate two rows of 32-bit values to bytes, the same way the scalar code stores them. */
+static FORCEINLINE __m128i packRows(const __m128i *rows) {
+	const __m128i mask = _mm_set1_epi32(0xFF);
+
+	return _mm_packus_epi16(_mm_packs_epi32(_mm_and_si128(rows[0], mask), _mm_and_si128(rows[1], mask)),
+	                        _mm_packs_epi32(_mm_and_si128(rows[2], mask), _mm_and_si128(rows[3], mask)));
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTSSE2(int32 *block) {
+	__m128i out[16];
+	idct(out, block);
+
+	for (int i = 0; i < 16; i++)
+		_mm_storeu_si128((__m128i *)(block + i * 4), out[i]);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTPutSSE2(byte *dest, uint32 pitch, const int32 *block) {
+	__m128i out[16];
+	idct(out, block);
+
+	for (int i = 0; i < 8; i += 2, dest += pitch * 2) {
+		__m128i rows = packRows(out + i * 2);
+
+		_mm_storel_epi64((__m128i *)dest, rows);
+		_mm_storel_epi64((__m128i *)(dest + pitch), _mm_srli_si128(rows, 8));
+	}
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTAddSSE2(byte *dest, uint32 pitch, const int32 *block) {
+	__m128i out[16];
+	idct(out, block);
+
+	for (int i = 0; i < 8; i += 2, dest += pitch * 2) {
+		__m128i rows = packRows(out + i * 2);
+
+		__m128i prev = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)dest),
+		                                  _mm_loadl_epi64((const __m128i *)(dest + pitch)));
+		rows = _mm_add_epi8(rows, prev);
+
+		_mm_storel_epi64((__m128i *)dest, rows);
+		_mm_storel_epi64((__m128i *)(dest + pitch), _mm_srli_si128(rows, 8));
+	}
+}
+
+} // End of namespace Video
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
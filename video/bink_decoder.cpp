@@ -281,6 +281,12 @@ BinkDecoder::BinkVideoTrack::BinkVideoTrack(uint32 width, uint32 height, uint32
 
 	_pixelFormat = g_system->getScreenFormat();
 
+#ifdef SCUMMVM_SSE2
+	_useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#else
+	_useSSE2 = false;
+#endif
+
 	// Default to a 32bpp format, if in 8bpp mode
 	if (_pixelFormat.bytesPerPixel == 1)
 		_pixelFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
@@ -813,7 +819,15 @@ void BinkDecoder::BinkVideoTrack::blockScaledIntra(DecodeContext &ctx) {
 
 	block[0] = getBundleValue(kSourceIntraDC);
 
-	readDCTCoeffs(*ctx.video, block, true);
+	if (!readDCTCoeffs(*ctx.video, block, true)) {
+		// Only a DC coefficient, the whole block has the same value
+		byte v = (block[0] + 0x7F) >> 8;
+
+		byte *dest = ctx.dest;
+		for (int i = 0; i < 16; i++, dest += ctx.pitch)
+			memset(dest, v, 16);
+		return;
+	}
 
 	IDCT(block);
 
@@ -958,7 +972,15 @@ void BinkDecoder::BinkVideoTrack::blockIntra(DecodeContext &ctx) {
 
 	block[0] = getBundleValue(kSourceIntraDC);
 
-	readDCTCoeffs(*ctx.video, block, true);
+	if (!readDCTCoeffs(*ctx.video, block, true)) {
+		// Only a DC coefficient, the whole block has the same value
+		byte v = (block[0] + 0x7F) >> 8;
+
+		byte *dest = ctx.dest;
+		for (int i = 0; i < 8; i++, dest += ctx.pitch)
+			memset(dest, v, 8);
+		return;
+	}
 
 	IDCTPut(ctx, block);
 }
@@ -979,7 +1001,18 @@ void BinkDecoder::BinkVideoTrack::blockInter(DecodeContext &ctx) {
 
 	block[0] = getBundleValue(kSourceInterDC);
 
-	readDCTCoeffs(*ctx.video, block, false);
+	if (!readDCTCoeffs(*ctx.video, block, false)) {
+		// Only a DC coefficient, the same difference is added to the whole block
+		byte v = (block[0] + 0x7F) >> 8;
+		if (!v)
+			return;
+
+		byte *dest = ctx.dest;
+		for (int i = 0; i < 8; i++, dest += ctx.pitch)
+			for (int j = 0; j < 8; j++)
+				dest[j] += v;
+		return;
+	}
 
 	IDCTAdd(ctx, block);
 }
@@ -1023,9 +1056,12 @@ void BinkDecoder::BinkVideoTrack::readRuns(VideoFrame &video, Bundle &bundle) {
 		memset(bundle.curDec, v, n);
 		bundle.curDec += n;
 
-	} else
-		while (bundle.curDec < decEnd)
-			*bundle.curDec++ = getHuffmanSymbol(video, bundle.huffman);
+	} else {
+		_huffman[bundle.huffman.index]->getSymbols(*video.bits, bundle.curDec, n);
+
+		for (; bundle.curDec < decEnd; bundle.curDec++)
+			*bundle.curDec = bundle.huffman.symbols[*bundle.curDec];
+	}
 }
 
 void BinkDecoder::BinkVideoTrack::readMotionValues(VideoFrame &video, Bundle &bundle) {
@@ -1210,8 +1246,8 @@ void BinkDecoder::BinkVideoTrack::readDCS(VideoFrame &video, Bundle &bundle) {
 	bundle.curDec = (byte *) dest;
 }
 
-/** Reads 8x8 block of DCT coefficients. */
-void BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int32 *block, bool isIntra) {
+/** Reads 8x8 block of DCT coefficients. Returns the number of AC coefficients read. */
+int BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int32 *block, bool isIntra) {
 	int coefCount = 0;
 	int coefIdx[64];
 
@@ -1310,6 +1346,7 @@ void BinkDecoder::BinkVideoTrack::readDCTCoeffs(VideoFrame &video, int32 *block,
 		block[binkScan[idx]] = (block[binkScan[idx]] * quant[idx]) >> 11;
 	}
 
+	return coefCount;
 }
 
 /** Reads 8x8 block with residue after motion compensation. */
@@ -1462,6 +1499,39 @@ static inline void IDCTCol(int32 *dest, const int32 *src) {
 }
 
 void BinkDecoder::BinkVideoTrack::IDCT(int32 *block) {
+#ifdef SCUMMVM_SSE2
+	if (_useSSE2) {
+		IDCTSSE2(block);
+		return;
+	}
+#endif
+
+	IDCTScalar(block);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
+#ifdef SCUMMVM_SSE2
+	if (_useSSE2) {
+		IDCTAddSSE2(ctx.dest, ctx.pitch, block);
+		return;
+	}
+#endif
+
+	IDCTAddScalar(ctx.dest, ctx.pitch, block);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int32 *block) {
+#ifdef SCUMMVM_SSE2
+	if (_useSSE2) {
+		IDCTPutSSE2(ctx.dest, ctx.pitch, block);
+		return;
+	}
+#endif
+
+	IDCTPutScalar(ctx.dest, ctx.pitch, block);
+}
+
+void BinkDecoder::BinkVideoTrack::IDCTScalar(int32 *block) {
 	int i;
 	int32 temp[64];
 
@@ -1472,23 +1542,22 @@ void BinkDecoder::BinkVideoTrack::IDCT(int32 *block) {
 	}
 }
 
-void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
+void BinkDecoder::BinkVideoTrack::IDCTAddScalar(byte *dest, uint32 pitch, int32 *block) {
 	int i, j;
 
-	IDCT(block);
-	byte *dest = ctx.dest;
-	for (i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
+	IDCTScalar(block);
+	for (i = 0; i < 8; i++, dest += pitch, block += 8)
 		for (j = 0; j < 8; j++)
 			 dest[j] += block[j];
 }
 
-void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int32 *block) {
+void BinkDecoder::BinkVideoTrack::IDCTPutScalar(byte *dest, uint32 pitch, const int32 *block) {
 	int i;
 	int32 temp[64];
 	for (i = 0; i < 8; i++)
 		IDCTCol(&temp[i], &block[i]);
 	for (i = 0; i < 8; i++) {
-		IDCT_ROW( (&ctx.dest[i*ctx.pitch]), (&temp[8*i]) );
+		IDCT_ROW( (&dest[i*pitch]), (&temp[8*i]) );
 	}
 }
 
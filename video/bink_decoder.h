@@ -58,6 +58,8 @@ namespace Graphics {
 struct Surface;
 }
 
+class BinkIDCTTestSuite;
+
 namespace Video {
 
 /**
@@ -67,6 +69,8 @@ namespace Video {
  *  - scumm (he)
  */
 class BinkDecoder : public VideoDecoder {
+	friend class ::BinkIDCTTestSuite;
+
 public:
 	BinkDecoder();
 	~BinkDecoder();
@@ -146,6 +150,8 @@ private:
 	};
 
 	class BinkVideoTrack : public FixedRateVideoTrack {
+		friend class ::BinkIDCTTestSuite;
+
 	public:
 		BinkVideoTrack(uint32 width, uint32 height, uint32 frameCount, const Common::Rational &frameRate, bool swapPlanes, bool hasAlpha, uint32 id);
 		~BinkVideoTrack();
@@ -275,6 +281,8 @@ private:
 		byte *_curPlanes[4]; ///< The 4 color planes, YUVA, current frame.
 		byte *_oldPlanes[4]; ///< The 4 color planes, YUVA, last frame.
 
+		bool _useSSE2; ///< Use the SSE2 IDCT?
+
 		/** Initialize the bundles. */
 		void initBundles();
 		/** Deinitialize the bundles. */
@@ -328,13 +336,23 @@ private:
 		void readColors      (VideoFrame &video, Bundle &bundle);
 		template<int startBits, bool hasSign>
 		void readDCS         (VideoFrame &video, Bundle &bundle);
-		void readDCTCoeffs   (VideoFrame &video, int32 *block, bool isIntra);
+		int  readDCTCoeffs   (VideoFrame &video, int32 *block, bool isIntra);
 		void readResidue     (VideoFrame &video, int16 *block, int masksCount);
 
 		// Bink video IDCT
 		void IDCT(int32 *block);
 		void IDCTPut(DecodeContext &ctx, int32 *block);
 		void IDCTAdd(DecodeContext &ctx, int32 *block);
+
+		static void IDCTScalar(int32 *block);
+		static void IDCTPutScalar(byte *dest, uint32 pitch, const int32 *block);
+		static void IDCTAddScalar(byte *dest, uint32 pitch, int32 *block);
+
+#ifdef SCUMMVM_SSE2
+		static void IDCTSSE2(int32 *block);
+		static void IDCTPutSSE2(byte *dest, uint32 pitch, const int32 *block);
+		static void IDCTAddSSE2(byte *dest, uint32 pitch, const int32 *block);
+#endif
 	};
 
 	class BinkAudioTrack : public AudioTrack {
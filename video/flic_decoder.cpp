@@ -96,6 +96,7 @@ FlicDecoder::FlicVideoTrack::FlicVideoTrack(Common::SeekableReadStream *stream,
 	_curFrame = -1;
 	_nextFrameStartTime = 0;
 	_atRingFrame = false;
+	_dirtyRectsCleared = false;
 
 	if (!skipHeader)
 		readHeader();
@@ -267,6 +268,17 @@ void FlicDecoder::FlicVideoTrack::copyDirtyRectsToBuffer(uint8 *dst, uint pitch)
 	clearDirtyRects();
 }
 
+bool FlicDecoder::FlicVideoTrack::getDirtyRects(Common::List<Common::Rect> &rects) {
+	for (Common::List<Common::Rect>::const_iterator it = _dirtyRects.begin(); it != _dirtyRects.end(); ++it)
+		rects.push_back(*it);
+
+	// The rects are incomplete if the caller of clearDirtyRects() took some
+	bool complete = !_dirtyRectsCleared;
+	_dirtyRects.clear();
+	_dirtyRectsCleared = false;
+	return complete;
+}
+
 void FlicDecoder::FlicVideoTrack::copyFrame(uint8 *data) {
 	memcpy((byte *)_surface->getPixels(), data, getWidth() * getHeight());
 
@@ -81,7 +81,8 @@ protected:
 		bool hasDirtyPalette() const { return _dirtyPalette; }
 
 		const Common::List<Common::Rect> *getDirtyRects() const { return &_dirtyRects; }
-		void clearDirtyRects() { _dirtyRects.clear(); }
+		void clearDirtyRects() { _dirtyRects.clear(); _dirtyRectsCleared = true; }
+		bool getDirtyRects(Common::List<Common::Rect> &rects);
 		void copyDirtyRectsToBuffer(uint8 *dst, uint pitch);
 
 	protected:
@@ -101,6 +102,7 @@ protected:
 		uint32 _nextFrameStartTime;
 
 		Common::List<Common::Rect> _dirtyRects;
+		bool _dirtyRectsCleared; ///< Were rects dropped since the last getDirtyRects() call?
 
 		void copyFrame(uint8 *data);
 		void decodeByteRun(uint8 *data);
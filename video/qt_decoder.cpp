@@ -744,18 +744,12 @@ QuickTimeDecoder::NodeData QuickTimeDecoder::getNodeData(uint32 nodeID) {
 
 Audio::Timestamp QuickTimeDecoder::VideoTrackHandler::getFrameTime(uint frame) const {
 	// TODO: This probably doesn't work right with edit lists
-	int cumulativeDuration = 0;
-	for (int ttsIndex = 0; ttsIndex < _parent->timeToSampleCount; ttsIndex++) {
-		const TimeToSampleEntry &tts = _parent->timeToSample[ttsIndex];
-		if ((int)frame < tts.count)
-			return Audio::Timestamp(0, _parent->timeScale).addFrames(cumulativeDuration + frame * tts.duration);
-		else {
-			frame -= tts.count;
-			cumulativeDuration += tts.duration * tts.count;
-		}
-	}
+	int ttsIndex = findTimeToSampleBySample(frame);
+	if (ttsIndex < 0)
+		return Audio::Timestamp().addFrames(-1);
 
-	return Audio::Timestamp().addFrames(-1);
+	const TimeToSampleEntry &tts = _parent->timeToSample[ttsIndex];
+	return Audio::Timestamp(0, _parent->timeScale).addFrames(tts.startTime + (frame - tts.firstSample) * tts.duration);
 }
 
 const byte *QuickTimeDecoder::VideoTrackHandler::getPalette() const {
@@ -835,72 +829,76 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 }
 
 Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
-	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
-	int32 totalSampleCount = 0;
-	int32 sampleInChunk = 0;
-	int32 actualChunk = -1;
-	uint32 sampleToChunkIndex = 0;
-
-	for (uint32 i = 0; i < _parent->chunkCount; i++) {
-		if (sampleToChunkIndex < _parent->sampleToChunkCount && i >= _parent->sampleToChunk[sampleToChunkIndex].first)
-			sampleToChunkIndex++;
-
-		totalSampleCount += _parent->sampleToChunk[sampleToChunkIndex - 1].count;
-
-		if (totalSampleCount > _curFrame) {
-			actualChunk = i;
-			descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
-			sampleInChunk = _parent->sampleToChunk[sampleToChunkIndex - 1].count - totalSampleCount + _curFrame;
-			break;
-		}
-	}
-
-	if (actualChunk < 0)
+	// The chunk and the position inside of it were resolved for every sample when parsing
+	if (_curFrame < 0 || (uint32)_curFrame >= _parent->sampleIndex.size())
 		error("Could not find data for frame %d", _curFrame);
 
-	// Next seek to that frame
+	const SampleIndexEntry &sample = _parent->sampleIndex[_curFrame];
+	descId = sample.descId;
+
+	// Read in the raw data for the frame
+	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, sample.offset, sample.size);
 	Common::SeekableReadStream *stream = _decoder->_fd;
-	stream->seek(_parent->chunkOffsets[actualChunk]);
+	stream->seek(sample.offset);
+	return stream->readStream(sample.size);
+}
 
-	// Then, if the chunk holds more than one frame, seek to where the frame we want is located
-	for (int32 i = _curFrame - sampleInChunk; i < _curFrame; i++) {
-		if (_parent->sampleSize != 0)
-			stream->skip(_parent->sampleSize);
+uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
+	int ttsIndex = findTimeToSampleBySample(_curFrame);
+
+	// This should never occur
+	if (ttsIndex < 0)
+		error("Cannot find duration for frame %d", _curFrame);
+
+	return _parent->timeToSample[ttsIndex].duration;
+}
+
+uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
+	// Binary search for the last keyframe at or before the frame
+	uint32 low = 0, high = _parent->keyframeCount;
+	while (low < high) {
+		uint32 mid = (low + high) / 2;
+		if (_parent->keyframes[mid] <= frame)
+			low = mid + 1;
 		else
-			stream->skip(_parent->sampleSizes[i]);
+			high = mid;
 	}
 
-	// Finally, read in the raw data for the frame
-	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, stream->pos(), _parent->sampleSizes[_curFrame]);
+	if (low > 0)
+		return _parent->keyframes[low - 1];
 
-	if (_parent->sampleSize != 0)
-		return stream->readStream(_parent->sampleSize);
-
-	return stream->readStream(_parent->sampleSizes[_curFrame]);
+	// If none found, we'll assume the requested frame is a key frame
+	return frame;
 }
 
-uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
-	uint32 curFrameIndex = 0;
-	for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
-		curFrameIndex += _parent->timeToSample[i].count;
-		if ((uint32)_curFrame < curFrameIndex) {
-			// Ok, now we have what duration this frame has.
-			return _parent->timeToSample[i].duration;
-		}
+int QuickTimeDecoder::VideoTrackHandler::findTimeToSampleBySample(uint32 sample) const {
+	// Binary search for the first entry ending after the sample
+	int low = 0, high = _parent->timeToSampleCount;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		const TimeToSampleEntry &tts = _parent->timeToSample[mid];
+		if (tts.firstSample + tts.count > sample)
+			high = mid;
+		else
+			low = mid + 1;
 	}
 
-	// This should never occur
-	error("Cannot find duration for frame %d", _curFrame);
-	return 0;
+	return (low < _parent->timeToSampleCount) ? low : -1;
 }
 
-uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
+int QuickTimeDecoder::VideoTrackHandler::findTimeToSampleByTime(uint32 mediaTime) const {
+	// Binary search for the first entry ending at or after the time
+	int low = 0, high = _parent->timeToSampleCount;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		const TimeToSampleEntry &tts = _parent->timeToSample[mid];
+		if (tts.startTime + tts.count * tts.duration >= mediaTime)
+			high = mid;
+		else
+			low = mid + 1;
+	}
 
-	// If none found, we'll assume the requested frame is a key frame
-	return frame;
+	return (low < _parent->timeToSampleCount) ? low : -1;
 }
 
 bool QuickTimeDecoder::VideoTrackHandler::isEmptyEdit() const {
@@ -921,30 +919,26 @@ void QuickTimeDecoder::VideoTrackHandler::enterNewEditListEntry(bool bufferFrame
 
 	uint32 mediaTime = _parent->editList[_curEdit].mediaTime;
 	uint32 frameNum = 0;
-	uint32 totalDuration = 0;
 	_durationOverride = -1;
 
 	// Track down where the mediaTime is in the media
 	// This is basically time -> frame mapping
 	// Note that this code uses first frame = 0
-	for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
-		uint32 duration = _parent->timeToSample[i].count * _parent->timeToSample[i].duration;
-
-		if (totalDuration + duration >= mediaTime) {
-			uint32 frameInc = (mediaTime - totalDuration) / _parent->timeToSample[i].duration;
-			frameNum += frameInc;
-			totalDuration += frameInc * _parent->timeToSample[i].duration;
-
-			// If we didn't get to the exact media time, mark an override for
-			// the time.
-			if (totalDuration != mediaTime)
-				_durationOverride = totalDuration + _parent->timeToSample[i].duration - mediaTime;
-
-			break;
-		}
+	int ttsIndex = findTimeToSampleByTime(mediaTime);
 
-		frameNum += _parent->timeToSample[i].count;
-		totalDuration += duration;
+	if (ttsIndex >= 0) {
+		const TimeToSampleEntry &tts = _parent->timeToSample[ttsIndex];
+		uint32 frameInc = (mediaTime - tts.startTime) / tts.duration;
+		frameNum = tts.firstSample + frameInc;
+		uint32 totalDuration = tts.startTime + frameInc * tts.duration;
+
+		// If we didn't get to the exact media time, mark an override for
+		// the time.
+		if (totalDuration != mediaTime)
+			_durationOverride = totalDuration + tts.duration - mediaTime;
+	} else {
+		// The edit starts past the end of the media
+		frameNum = _parent->frameCount;
 	}
 
 	if (bufferFrames) {
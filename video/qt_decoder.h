@@ -242,6 +242,8 @@ private:
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
 		uint32 getCurFrameDuration();            // media time
 		uint32 findKeyFrame(uint32 frame) const;
+		int findTimeToSampleBySample(uint32 sample) const;
+		int findTimeToSampleByTime(uint32 mediaTime) const; // media time
 		bool isEmptyEdit() const;
 		void enterNewEditListEntry(bool bufferFrames, bool intializingTrack = false);
 		const Graphics::Surface *bufferNextFrame();
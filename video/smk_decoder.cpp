@@ -166,14 +166,19 @@ private:
 		SMK_NODE = 0x80000000
 	};
 
+	enum {
+		// Codes of up to this many bits are resolved with a single lookup
+		SMK_PREFIX_BITS = 10
+	};
+
 	uint32 decodeTree(uint32 prefix, int length);
 
 	uint32  _treeSize;
 	uint32 *_tree;
 	uint32  _last[3];
 
-	uint32 _prefixtree[256];
-	byte _prefixlength[256];
+	uint32 _prefixtree[1 << SMK_PREFIX_BITS];
+	byte _prefixlength[1 << SMK_PREFIX_BITS];
 
 	/* Used during construction */
 	SmackerBitStream &_bs;
@@ -184,6 +189,9 @@ private:
 
 BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 	: _bs(bs) {
+	for (uint32 i = 0; i < (1 << SMK_PREFIX_BITS); ++i)
+		_prefixtree[i] = _prefixlength[i] = 0;
+
 	uint32 bit = _bs.getBit();
 	if (!bit) {
 		_tree = new uint32[1];
@@ -192,9 +200,6 @@ BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 		return;
 	}
 
-	for (uint32 i = 0; i < 256; ++i)
-		_prefixtree[i] = _prefixlength[i] = 0;
-
 	_loBytes = new SmallHuffmanTree(_bs);
 	_hiBytes = new SmallHuffmanTree(_bs);
 
@@ -239,8 +244,8 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 		_tree[_treeSize] = v;
 
-		if (length <= 8) {
-			for (int i = 0; i < 256; i += (1 << length)) {
+		if (length <= SMK_PREFIX_BITS) {
+			for (int i = 0; i < (1 << SMK_PREFIX_BITS); i += (1 << length)) {
 				_prefixtree[prefix | i] = _treeSize;
 				_prefixlength[prefix | i] = length;
 			}
@@ -259,9 +264,9 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 	uint32 t = _treeSize++;
 
-	if (length == 8) {
+	if (length == SMK_PREFIX_BITS) {
 		_prefixtree[prefix] = t;
-		_prefixlength[prefix] = 8;
+		_prefixlength[prefix] = SMK_PREFIX_BITS;
 	}
 
 	uint32 r1 = decodeTree(prefix, length + 1);
@@ -276,7 +281,7 @@ uint32 BigHuffmanTree::getCode(SmackerBitStream &bs) {
 	// Peeking data out of bounds is well-defined and returns 0 bits.
 	// This is for convenience when using speed-up techniques reading
 	// more bits than actually available.
-	byte peek = bs.peekBits<8>();
+	uint32 peek = bs.peekBits<SMK_PREFIX_BITS>();
 	uint32 *p = &_tree[_prefixtree[peek]];
 	bs.skip(_prefixlength[peek]);
 
@@ -604,6 +609,7 @@ SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height
 	_surface = new Graphics::Surface();
 	_surface->create(width, height * ((flags & 6) ? 2 : 1), Graphics::PixelFormat::createFormatCLUT8());
 	_dirtyBlocks.set_size(width * height / 16);
+	_changedBlocks.set_size(width * height / 16);
 	_frameCount = frameCount;
 	_frameRate = frameRate;
 	_flags = flags;
@@ -649,6 +655,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 	_FullTree->reset();
 	_TypeTree->reset();
 	_dirtyBlocks.clear();
+	_changedBlocks.clear();
 
 	// Height needs to be doubled if we have flags (Y-interlaced or Y-doubled)
 	uint doubleY = (_flags & 6) ? 2 : 1;
@@ -658,10 +665,18 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 	uint stride = getWidth();
 	uint block = 0, blocks = bw*bh;
 
+	// Masks selecting the bytes of a 4 pixel row, indexed by a nibble of a mono block map
+	static const uint32 monoMasks[16] = {
+		0x00000000, 0x000000FF, 0x0000FF00, 0x0000FFFF,
+		0x00FF0000, 0x00FF00FF, 0x00FFFF00, 0x00FFFFFF,
+		0xFF000000, 0xFF0000FF, 0xFF00FF00, 0xFF00FFFF,
+		0xFFFF0000, 0xFFFF00FF, 0xFFFFFF00, 0xFFFFFFFF
+	};
+
 	byte *out;
 	uint type, run, j, mode;
 	uint32 p1, p2, clr, map;
-	byte hi, lo;
+	uint32 hi, lo, row;
 	uint i;
 
 	while (block < blocks) {
@@ -674,19 +689,18 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 				clr = _MClrTree->getCode(bs);
 				map = _MMapTree->getCode(bs);
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				hi = clr >> 8;
-				lo = clr & 0xff;
+				hi = ((clr >> 8) & 0xff) * 0x01010101;
+				lo = (clr & 0xff) * 0x01010101;
 				for (i = 0; i < 4; i++) {
+					row = lo ^ ((lo ^ hi) & monoMasks[map & 15]);
 					for (j = 0; j < doubleY; j++) {
-						out[0] = (map & 1) ? hi : lo;
-						out[1] = (map & 2) ? hi : lo;
-						out[2] = (map & 4) ? hi : lo;
-						out[3] = (map & 8) ? hi : lo;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 					}
 					map >>= 4;
 				}
 				_dirtyBlocks.set(block);
+				_changedBlocks.set(block);
 				++block;
 			}
 			break;
@@ -713,29 +727,25 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 						for (i = 0; i < 4; ++i) {
 							p1 = _FullTree->getCode(bs);
 							p2 = _FullTree->getCode(bs);
+							row = (p2 & 0xffff) | (p1 << 16);
 							for (j = 0; j < doubleY; ++j) {
-								out[2] = p1 & 0xff;
-								out[3] = p1 >> 8;
-								out[0] = p2 & 0xff;
-								out[1] = p2 >> 8;
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
 						break;
 					case 1:
 						p1 = _FullTree->getCode(bs);
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						row = (p1 & 0xff) * 0x0101 + ((p1 >> 8) & 0xff) * 0x01010000;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						p2 = _FullTree->getCode(bs);
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						row = (p2 & 0xff) * 0x0101 + ((p2 >> 8) & 0xff) * 0x01010000;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						break;
 					case 2:
@@ -745,18 +755,9 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 							// https://ffmpeg.org/pipermail/ffmpeg-devel/2008-December/044246.html
 							p2 = _FullTree->getCode(bs);
 							p1 = _FullTree->getCode(bs);
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
-								out += stride;
-							}
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
+							row = (p1 & 0xffff) | (p2 << 16);
+							for (j = 0; j < 2 * doubleY; ++j) {
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
@@ -765,6 +766,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 						break;
 				}
 				_dirtyBlocks.set(block);
+				_changedBlocks.set(block);
 				++block;
 			}
 			break;
@@ -777,12 +779,13 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 			mode = type >> 8;
 			while (run-- && block < blocks) {
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				col = mode * 0x01010101;
+				col = (mode & 0xff) * 0x01010101;
 				for (i = 0; i < 4 * doubleY; ++i) {
-					out[0] = out[1] = out[2] = out[3] = col;
+					WRITE_UINT32(out, col);
 					out += stride;
 				}
 				_dirtyBlocks.set(block);
+				_changedBlocks.set(block);
 				++block;
 			}
 			break;
@@ -973,6 +976,22 @@ const Common::Rect *SmackerDecoder::getNextDirtyRect() {
 }
 
 const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
+	if (!findDirtyRect(_dirtyBlocks, _lastDirtyRect))
+		return nullptr;
+
+	return &_lastDirtyRect;
+}
+
+bool SmackerDecoder::SmackerVideoTrack::getDirtyRects(Common::List<Common::Rect> &rects) {
+	// getNextDirtyRect() consumes _dirtyBlocks, so use a set of our own
+	Common::Rect rect;
+	while (findDirtyRect(_changedBlocks, rect))
+		rects.push_back(rect);
+
+	return true;
+}
+
+bool SmackerDecoder::SmackerVideoTrack::findDirtyRect(Common::BitArray &dirtyBlocks, Common::Rect &rect) const {
 	uint doubleY = (_flags & 6) ? 2 : 1;
 
 	uint bw = getWidth() / 4;
@@ -980,13 +999,13 @@ const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 	uint blocks = bw*bh;
 
 	// Scan forward in dirty blocks bitarray for next dirty rect
-	uint block_idx = (_lastDirtyRect.left) / 4 + (_lastDirtyRect.top / 4 / doubleY) * bw;
-	while (block_idx < blocks && !_dirtyBlocks.get(block_idx)) {
+	uint block_idx = (rect.left) / 4 + (rect.top / 4 / doubleY) * bw;
+	while (block_idx < blocks && !dirtyBlocks.get(block_idx)) {
 		++block_idx;
 	}
 	if (block_idx == blocks) {
-		_lastDirtyRect = Common::Rect();
-		return nullptr;
+		rect = Common::Rect();
+		return false;
 	}
 
 	uint block_x0 = block_idx % bw;
@@ -994,7 +1013,7 @@ const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 
 	// Find the width of the dirty rect
 	uint block_x1 = block_x0 + 1;
-	while (block_x1 < bw && _dirtyBlocks.get(block_x1 + block_y0 * bw)) {
+	while (block_x1 < bw && dirtyBlocks.get(block_x1 + block_y0 * bw)) {
 		++block_x1;
 	}
 
@@ -1002,14 +1021,14 @@ const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 	uint block_y1 = block_y0 + 1;
 	while (block_y1 < bh) {
 		// Check that the rect to the left of the next line isn't dirty
-		if (block_x0 != 0 && _dirtyBlocks.get(block_x0 - 1 + block_y1 * bw)) {
+		if (block_x0 != 0 && dirtyBlocks.get(block_x0 - 1 + block_y1 * bw)) {
 			break;
 		}
 
 		// Check that all the rects on this line are dirty
 		uint bx;
 		for (bx = block_x0; bx != block_x1; ++bx) {
-			if (!_dirtyBlocks.get(bx + block_y1 * bw)) {
+			if (!dirtyBlocks.get(bx + block_y1 * bw)) {
 				break;
 			}
 		}
@@ -1018,7 +1037,7 @@ const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 		}
 
 		// Check that the rect to the right of this line isn't dirty
-		if (bx != bw && _dirtyBlocks.get(bx + block_y1 * bw)) {
+		if (bx != bw && dirtyBlocks.get(bx + block_y1 * bw)) {
 			break;
 		}
 		++block_y1;
@@ -1027,17 +1046,17 @@ const Common::Rect *SmackerDecoder::SmackerVideoTrack::getNextDirtyRect() {
 	// Undirty all the rects that we're returning
 	for (uint y = block_y0; y != block_y1; ++y) {
 		for (uint x = block_x0; x != block_x1; ++x) {
-			_dirtyBlocks.unset(x + y * bw);
+			dirtyBlocks.unset(x + y * bw);
 		}
 	}
 
-	_lastDirtyRect = Common::Rect(
+	rect = Common::Rect(
 		int16(4 * block_x0),
 		int16(4 * block_y0 * doubleY),
 		int16(4 * block_x1),
 		int16(4 * block_y1 * doubleY)
 	);
-	return &_lastDirtyRect;
+	return true;
 }
 
 } // End of namespace Video
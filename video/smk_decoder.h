@@ -121,6 +121,7 @@ protected:
 		Common::Rational getFrameRate() const { return _frameRate; }
 
 		const Common::Rect *getNextDirtyRect();
+		bool getDirtyRects(Common::List<Common::Rect> &rects);
 
 	protected:
 		Graphics::Surface *_surface;
@@ -140,9 +141,16 @@ protected:
 		BigHuffmanTree *_FullTree;
 		BigHuffmanTree *_TypeTree;
 
-		Common::BitArray _dirtyBlocks;
+		Common::BitArray _dirtyBlocks;   ///< Blocks not yet returned by getNextDirtyRect()
+		Common::BitArray _changedBlocks; ///< Blocks not yet returned by getDirtyRects()
 		Common::Rect _lastDirtyRect;
 
+		/**
+		 * Find the next rect of blocks set in @p dirtyBlocks, starting at the
+		 * position of @p rect, and unset them.
+		 */
+		bool findDirtyRect(Common::BitArray &dirtyBlocks, Common::Rect &rect) const;
+
 		// Possible runs of blocks
 		static uint getBlockRun(int index) { return (index <= 58) ? index + 1 : 128 << (index - 59); }
 	};
@@ -28,6 +28,9 @@
 #include "common/file.h"
 #include "common/system.h"
 
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+
 namespace Video {
 
 VideoDecoder::VideoDecoder() {
@@ -48,12 +51,24 @@ VideoDecoder::VideoDecoder() {
 	_canSetDither = true;
 	_canSetDefaultFormat = true;
 	_videoCodecAccuracy = Image::CodecAccuracy::Default;
+	_shownDecodedFrame = 0;
+	_decodeAheadFrames = 0;
+	_directPixels = 0;
+	_directX = _directY = 0;
+	_directFrame = -1;
+}
+
+VideoDecoder::~VideoDecoder() {
+	freeDecodedFrames();
 }
 
 void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
 
+	freeDecodedFrames();
+	_directPixels = 0;
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		delete *it;
 
@@ -114,6 +129,8 @@ bool VideoDecoder::needsUpdate() const {
 }
 
 void VideoDecoder::delayMillis(uint msecs) {
+	decodeAhead();
+
 	if (!needsUpdate())
 		g_system->delayMillis(MIN<uint>(msecs, getTimeToNextFrame()));
 	else
@@ -212,6 +229,23 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_canSetDither = false;
 	_canSetDefaultFormat = false;
 
+	if (!_decodedFrames.empty()) {
+		// The previously shown frame is no longer referenced by the caller
+		if (_shownDecodedFrame)
+			_freeDecodedFrames.push_back(_shownDecodedFrame);
+
+		_shownDecodedFrame = _decodedFrames.remove_at(0);
+
+		if (_shownDecodedFrame->hasPalette) {
+			memcpy(_decodedPalette, _shownDecodedFrame->palette, sizeof(_decodedPalette));
+			_palette = _decodedPalette;
+			_dirtyPalette = true;
+		}
+
+		findNextVideoTrack();
+		return _shownDecodedFrame->surface;
+	}
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -232,11 +266,189 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	return frame;
 }
 
+bool VideoDecoder::decodeNextFrameInto(Graphics::Surface &dst, int x, int y, Common::List<Common::Rect> *changedRects) {
+	const Graphics::Surface *frame = decodeNextFrame();
+	if (!frame)
+		return false;
+
+	const bool applyPalette = frame->format.isCLUT8() && !dst.format.isCLUT8();
+	if (dst.format.isCLUT8() && !frame->format.isCLUT8())
+		return false;
+
+	// The changes reported by the track can only be used on top of the
+	// previous frame, drawn to the same place. Queued frames were decoded
+	// before the changes of the frame shown before them were collected.
+	Common::List<Common::Rect> rects;
+	VideoTrack *track = getSingleVideoTrack();
+	bool drawChanges = track && track->getDirtyRects(rects);
+
+	if (!drawChanges || _decodeAheadFrames || !_directPixels || _directPixels != dst.getPixels() ||
+			_directX != x || _directY != y || getCurFrame() != _directFrame + 1 || (applyPalette && _dirtyPalette)) {
+		rects.clear();
+		rects.push_back(Common::Rect(frame->w, frame->h));
+	}
+
+	uint32 map[256];
+	if (applyPalette) {
+		if (_palette)
+			Graphics::convertPaletteToMap(map, _palette, 256, dst.format);
+		else
+			memset(map, 0, sizeof(map));
+
+		_dirtyPalette = false;
+	}
+
+	Common::Rect bounds(x, y, x + frame->w, y + frame->h);
+	bounds.clip(Common::Rect(dst.w, dst.h));
+
+	for (Common::List<Common::Rect>::iterator it = rects.begin(); it != rects.end(); ++it) {
+		Common::Rect rect = *it;
+		rect.translate(x, y);
+		rect.clip(bounds);
+		if (rect.isEmpty())
+			continue;
+
+		const byte *src = (const byte *)frame->getBasePtr(rect.left - x, rect.top - y);
+		byte *dstPtr = (byte *)dst.getBasePtr(rect.left, rect.top);
+
+		if (applyPalette)
+			Graphics::crossBlitMap(dstPtr, src, dst.pitch, frame->pitch, rect.width(), rect.height(), dst.format.bytesPerPixel, map);
+		else if (frame->format == dst.format)
+			Graphics::copyBlit(dstPtr, src, dst.pitch, frame->pitch, rect.width(), rect.height(), dst.format.bytesPerPixel);
+		else
+			Graphics::crossBlit(dstPtr, src, dst.pitch, frame->pitch, rect.width(), rect.height(), dst.format, frame->format);
+
+		if (changedRects)
+			changedRects->push_back(rect);
+	}
+
+	_directPixels = _decodeAheadFrames ? 0 : dst.getPixels();
+	_directX = x;
+	_directY = y;
+	_directFrame = getCurFrame();
+	return true;
+}
+
+void VideoDecoder::setDecodeAhead(uint frames) {
+	_decodeAheadFrames = frames;
+}
+
+void VideoDecoder::decodeAhead() {
+	if (!_decodeAheadFrames || !isPlaying() || isPaused())
+		return;
+
+	VideoTrack *track = getSingleVideoTrack();
+	if (!track)
+		return;
+
+	// Stop as soon as the next frame is due, so that the caller can show it
+	while (_decodedFrames.size() < _decodeAheadFrames && getTimeToNextFrame() != 0) {
+		if (track->endOfTrack() || track->isReversed())
+			return;
+
+		uint32 startTime = track->getNextFrameStartTime();
+		if (_endTimeSet && startTime >= (uint)_endTime.msecs())
+			return;
+
+		_canSetDither = false;
+		_canSetDefaultFormat = false;
+
+		readNextPacket();
+		const Graphics::Surface *surface = track->decodeNextFrame();
+
+		DecodedFrame *decoded;
+		if (_freeDecodedFrames.empty()) {
+			decoded = new DecodedFrame();
+			decoded->surface = 0;
+		} else {
+			decoded = _freeDecodedFrames.back();
+			_freeDecodedFrames.pop_back();
+		}
+
+		if (surface) {
+			// Reuse the storage of a recycled frame when the size matches
+			if (decoded->surface && decoded->surface->w == surface->w && decoded->surface->h == surface->h && decoded->surface->format == surface->format) {
+				decoded->surface->copyRectToSurface(*surface, 0, 0, Common::Rect(surface->w, surface->h));
+			} else {
+				if (!decoded->surface)
+					decoded->surface = new Graphics::Surface();
+				decoded->surface->copyFrom(*surface);
+			}
+		} else if (decoded->surface) {
+			decoded->surface->free();
+			delete decoded->surface;
+			decoded->surface = 0;
+		}
+
+		decoded->frame = track->getCurFrame();
+		decoded->startTime = startTime;
+		decoded->hasPalette = track->hasDirtyPalette();
+		if (decoded->hasPalette)
+			memcpy(decoded->palette, track->getPalette(), sizeof(decoded->palette));
+
+		_decodedFrames.push_back(decoded);
+	}
+}
+
+VideoDecoder::VideoTrack *VideoDecoder::getSingleVideoTrack() const {
+	VideoTrack *videoTrack = 0;
+
+	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo) {
+			// Only a single video track keeps the frame order unambiguous
+			if (videoTrack)
+				return 0;
+
+			videoTrack = (VideoTrack *)*it;
+		}
+	}
+
+	return videoTrack;
+}
+
+bool VideoDecoder::hasDecodedFramesLeft() const {
+	if (_decodedFrames.empty())
+		return false;
+
+	// The end time may have been set after the frames were queued
+	return !(_endTimeSet && isPlaying() && _decodedFrames[0]->startTime >= (uint)_endTime.msecs());
+}
+
+void VideoDecoder::flushDecodeAhead() {
+	for (uint i = 0; i < _decodedFrames.size(); i++)
+		_freeDecodedFrames.push_back(_decodedFrames[i]);
+
+	_decodedFrames.clear();
+}
+
+void VideoDecoder::freeDecodedFrames() {
+	flushDecodeAhead();
+
+	if (_shownDecodedFrame)
+		_freeDecodedFrames.push_back(_shownDecodedFrame);
+	_shownDecodedFrame = 0;
+
+	for (uint i = 0; i < _freeDecodedFrames.size(); i++) {
+		if (_freeDecodedFrames[i]->surface) {
+			_freeDecodedFrames[i]->surface->free();
+			delete _freeDecodedFrames[i]->surface;
+		}
+		delete _freeDecodedFrames[i];
+	}
+
+	_freeDecodedFrames.clear();
+}
+
 bool VideoDecoder::setReverse(bool reverse) {
 	// Can only reverse video-only videos
 	if (reverse && hasAudio())
 		return false;
 
+	// The tracks have already been decoded past the frames still queued,
+	// so move them back to the first queued frame before reversing
+	if (reverse && !_decodedFrames.empty() && !seekToFrame(_decodedFrames[0]->frame))
+		return false;
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -257,6 +469,10 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	// The tracks are ahead of what has been shown
+	if (!_decodedFrames.empty())
+		return _decodedFrames[0]->frame - 1;
+
 	int32 frame = -1;
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
@@ -298,7 +514,17 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (_needsUpdate)
+		return 0;
+
+	// Frames decoded ahead of time are always played forward
+	if (!_decodedFrames.empty()) {
+		uint32 currentTime = getTime();
+		uint32 nextFrameStartTime = _decodedFrames[0]->startTime;
+		return (nextFrameStartTime <= currentTime) ? 0 : nextFrameStartTime - currentTime;
+	}
+
+	if (endOfVideo() || !_nextVideoTrack)
 		return 0;
 
 	uint32 currentTime = getTime();
@@ -320,6 +546,9 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	if (hasDecodedFramesLeft())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		const Track *track = *it;
 
@@ -347,6 +576,9 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	flushDecodeAhead();
+	_directPixels = 0;
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -381,6 +613,9 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	flushDecodeAhead();
+	_directPixels = 0;
+
 	// Stop all tracks so they can be seek'ed
 	if (isPlaying())
 		stopAudio();
@@ -964,6 +1199,9 @@ const VideoDecoder::Track *VideoDecoder::getTrack(uint track) const {
 }
 
 bool VideoDecoder::endOfVideoTracks() const {
+	if (!_decodedFrames.empty())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && !(*it)->endOfTrack())
 			return false;
@@ -1026,6 +1264,9 @@ bool VideoDecoder::hasFramesLeft() const {
 	// This is similar to endOfVideo(), except it doesn't take Audio into account (and returns true if not the end of the video)
 	// This is only used for needsUpdate() atm so that setEndTime() works properly
 	// And unlike endOfVideoTracks(), this takes into account _endTime
+	if (hasDecodedFramesLeft())
+		return true;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() != Track::kTrackTypeVideo)
 			continue;
@@ -25,8 +25,10 @@
 #include "audio/mixer.h"
 #include "audio/timestamp.h"	// TODO: Move this to common/ ?
 #include "common/array.h"
+#include "common/list.h"
 #include "common/path.h"
 #include "common/rational.h"
+#include "common/rect.h"
 #include "common/str.h"
 #include "graphics/pixelformat.h"
 #include "image/codec-options.h"
@@ -53,7 +55,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -333,9 +335,30 @@ public:
 	/**
 	 * Delay/sleep for the specified amount of milliseconds, or until the next
 	 * frame should be displayed.
+	 *
+	 * If decode-ahead is enabled, upcoming frames are decoded first.
 	 */
 	void delayMillis(uint msecs);
 
+	/**
+	 * Allow decoding up to the given number of frames before they are due,
+	 * in order to absorb frames that take longer to decode than their
+	 * display interval. 0 (the default) disables decode-ahead.
+	 *
+	 * Frames are only decoded ahead by decodeAhead() (which delayMillis()
+	 * calls), and only for videos with a single video track played forward.
+	 * decodeNextFrame() then returns the queued frames in order. Seeking and
+	 * rewinding drop the queue.
+	 */
+	void setDecodeAhead(uint frames);
+
+	/**
+	 * Decode upcoming frames into the decode-ahead queue while the next
+	 * frame is not due yet. Meant to be called while waiting for the next
+	 * frame, instead of sleeping. Does nothing if decode-ahead is disabled.
+	 */
+	void decodeAhead();
+
 	/**
 	 * Return the time (in ms) until the next frame should be displayed.
 	 */
@@ -365,6 +388,30 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Decode the next frame and draw it straight into a caller-supplied
+	 * surface, such as the one returned by OSystem::lockScreen().
+	 *
+	 * The frame is converted to the pixel format of @p dst while it is
+	 * drawn, so no intermediate converted copy is needed. When the video
+	 * track reports which areas of the frame changed, and the previous
+	 * frame was drawn to the same place with this function, only those
+	 * areas are written.
+	 *
+	 * Paletted videos can be drawn into a CLUT8 surface, in which case the
+	 * caller still has to apply getPalette(), or into a high color surface,
+	 * in which case the palette is applied here and hasDirtyPalette() is
+	 * reset. High color videos need a high color surface.
+	 *
+	 * @param dst          The surface to draw into
+	 * @param x            The left position of the video in @p dst
+	 * @param y            The top position of the video in @p dst
+	 * @param changedRects If not 0, the areas of @p dst that were written are appended to it
+	 * @return true if a frame was drawn, false if there was no new frame or
+	 *         it cannot be drawn in the format of @p dst
+	 */
+	bool decodeNextFrameInto(Graphics::Surface &dst, int x = 0, int y = 0, Common::List<Common::Rect> *changedRects = 0);
+
 	/**
 	 * Set the video to decode frames in reverse.
 	 *
@@ -644,6 +691,16 @@ protected:
 		 */
 		virtual bool hasDirtyPalette() const { return false; }
 
+		/**
+		 * Get the areas of the frame that changed since the last call.
+		 *
+		 * The areas are appended to @p rects. By default, tracks do not keep
+		 * track of their changes, and the whole frame is considered changed.
+		 *
+		 * @return true if @p rects covers all changes, false if they are unknown
+		 */
+		virtual bool getDirtyRects(Common::List<Common::Rect> &rects) { return false; }
+
 		/**
 		 * Get the time the given frame should be shown.
 		 *
@@ -1000,6 +1057,36 @@ private:
 	bool _canSetDither;
 	bool _canSetDefaultFormat;
 
+	// Frames decoded ahead of time, oldest first, and their recycled storage
+	struct DecodedFrame {
+		Graphics::Surface *surface; // 0 if the track returned no frame
+		int frame;
+		uint32 startTime;
+		bool hasPalette;
+		byte palette[256 * 3];
+	};
+
+	Common::Array<DecodedFrame *> _decodedFrames;
+	Common::Array<DecodedFrame *> _freeDecodedFrames;
+	DecodedFrame *_shownDecodedFrame;
+	uint _decodeAheadFrames;
+
+	// Palette of the last dequeued frame, the queued frames get recycled
+	byte _decodedPalette[256 * 3];
+
+	bool hasDecodedFramesLeft() const;
+	void flushDecodeAhead();
+	void freeDecodedFrames();
+
+	// Where decodeNextFrameInto() drew the last frame, _directPixels is 0 if
+	// the next frame has to be drawn in full
+	const void *_directPixels;
+	int _directX, _directY;
+	int _directFrame;
+
+	/** Get the only video track, or 0 if there is none or more than one. */
+	VideoTrack *getSingleVideoTrack() const;
+
 protected:
 	// Internal helper functions
 	void stopAudio();